@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct ArenaBlock ArenaBlock;
+typedef struct Arena Arena;
+
+/**
+ * @brief Arena 中的一块连续内存
+ * 多个 Block 以单链表串起，新 Block 总是挂在表头。
+ */
+struct ArenaBlock
+{
+    ArenaBlock *next; // 上一个（更早分配的）Block
+    size_t size;      // data 区的总字节数
+    size_t used;      // 已经分配出去的字节数
+    char data[];      // 实际的数据区
+};
+
+/**
+ * @brief 区域分配器 (Bump / Region Arena)
+ * 分配只是移动指针，不能单独释放某个对象，
+ * 整个区域通过 arena_free 一次性归还。
+ *
+ * 超过 block_size 的对象单独占一个 Block，挂在 head 之后，
+ * head 的剩余空间留给之后的小对象继续使用。
+ *
+ * @note 适合 "一个文件一个 Arena" 的场景：
+ * Token、StatementUnit、DeclUnit 等的生命周期与文件相同，
+ * 不需要再递归调用各自的 *_free。
+ */
+struct Arena
+{
+    ArenaBlock *head;       // 当前正在使用的 Block
+    size_t block_size;      // 新 Block 的默认大小
+    void *last;             // 最近一次分配的地址，用于原地扩容
+    ArenaBlock *last_block; // last 所在的 Block，不一定是 head
+};
+
+/**
+ * @brief 创建一个新的 Arena
+ *
+ * @param block_size 每个 Block 的字节大小，
+ * 为 0 时使用默认值 (64 KiB)
+ *
+ * @return 返回一个新的 Arena，失败返回 NULL
+ */
+Arena *arena_new(size_t block_size);
+
+/**
+ * @brief 释放 Arena 以及从中分配的所有内存
+ *
+ * @param arena 进行操作的 Arena
+ *
+ * @note 释放前应当先用 arena_use 切换掉该 Arena。
+ */
+void arena_free(Arena *arena);
+
+/**
+ * @brief 从 Arena 中分配一段内存
+ *
+ * @param arena 进行操作的 Arena
+ * @param size 需要的字节数
+ *
+ * @return void* 按 max_align_t 对齐的内存，失败返回 NULL
+ *
+ * @note 内存内容未初始化。
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief 设置当前线程的活动 Arena
+ *
+ * @param arena 新的活动 Arena，为 NULL 时恢复使用 malloc
+ *
+ * @return Arena* 之前的活动 Arena，便于调用者恢复
+ *
+ * @note 活动 Arena 是线程局部的，不同线程互不影响。
+ */
+Arena *arena_use(Arena *arena);
+
+/**
+ * @brief 获取当前线程的活动 Arena
+ *
+ * @return Arena* 当前活动 Arena，没有时返回 NULL
+ */
+Arena *arena_current(void);
+
+// === 统一的内存分配入口 ===
+// 有活动 Arena 时从 Arena 分配，mem_free 不做任何事；
+// 否则直接转发给 malloc / calloc / realloc / free。
+//
+// mem_realloc / mem_free 只看当前的活动 Arena，不看指针从哪里来：
+// 一段内存必须在分配它时的同一个活动 Arena (或同样没有 Arena) 下调整大小和释放，
+// 否则 Arena 中的内存会被交给 free，或 malloc 得到的内存永远不会释放。
+// 跨越 arena_use 切换的长期对象应当记下自己的 Arena，如 NormStream。
+
+void *mem_alloc(size_t size);
+void *mem_calloc(size_t count, size_t size);
+
+/**
+ * @brief 调整一段内存的大小
+ *
+ * @param ptr 原内存，可以为 NULL
+ * @param old_size 原内存的字节数（Arena 模式下拷贝时使用）
+ * @param new_size 新的字节数
+ *
+ * @return void* 新内存，失败返回 NULL 且原内存不变
+ *
+ * @note ptr 必须是在同一个活动 Arena 下分配的。
+ */
+void *mem_realloc(void *ptr, size_t old_size, size_t new_size);
+
+// 释放 ptr；与 mem_realloc 相同，必须在分配它时的活动 Arena 下调用
+void mem_free(void *ptr);
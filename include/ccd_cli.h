@@ -3,6 +3,7 @@
 #include <stddef.h>
 
 typedef struct Vector Vector;
+typedef struct SourceFile SourceFile;
 typedef enum CompileStage CompileStage;
 typedef struct CompileOptions CompileOptions;
 
@@ -10,6 +11,8 @@ enum CompileStage
 {
     STAGE_TOKENS, // 仅词法分析
     STAGE_UNITS,  // 粗粒度语句单元
+    STAGE_NORM,   // 归一化后的符号流
+    STAGE_FP,     // Winnowing 选出的指纹
     STAGE_AST,    // AST（未来）
     STAGE_IR,     // IR（未来）
 };
@@ -18,14 +21,23 @@ struct CompileOptions
 {
     const char *input;
     CompileStage stage;
+    size_t jobs; // 语句单元扫描的线程数，0 表示按 CPU 个数
 };
 
 void parse_args(int argc, char **argv, CompileOptions *opt);
 
-char *read_file(const char *path, size_t *out_len);
+// Token 只是源码缓冲区上的视图，
+// 源码通过 out_src 交还给调用者，需要在 Token 用完后再 source_file_close
+Vector *load_and_tokenize(const char *path, SourceFile **out_src);
 
-Vector *load_and_tokenize(const char *path);
+// src 用于把 Token 的字节偏移换算成行列号
+void dump_tokens(Vector *tokens, const SourceFile *src);
 
-void dump_tokens(Vector *tokens);
+// 与 dump_tokens 相同，但输出归一化后的符号
+void dump_normalized(Vector *tokens, const SourceFile *src);
 
-void dump_units(Vector *tokens);
\ No newline at end of file
+// 输出 Winnowing 选出的指纹及其在源码中的位置
+void dump_fingerprints(Vector *tokens, const SourceFile *src);
+
+// jobs 不为 1 时使用 scan_file_parallel
+void dump_units(Vector *tokens, size_t jobs);
\ No newline at end of file
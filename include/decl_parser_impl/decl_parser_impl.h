@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 typedef struct Vector Vector;
 typedef struct Token Token;
 typedef struct DeclParam DeclParam;
@@ -10,8 +13,9 @@ typedef struct StatementUnit StatementUnit;
 typedef struct DeclUnit DeclUnit;
 typedef struct DeclParser DeclParser;
 
-int is_in_typedef_table(char *name);
-int is_in_sue_table(char *name);
+// 以标识符的驻留 id (Token.id) 查询
+int is_in_typedef_table(uint32_t id);
+int is_in_sue_table(uint32_t id);
 
 int is_declaration_statement(StatementUnit *su);
 
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include "decl_parser_impl/scope_impl/scope_table.h"
 
 typedef struct Scope Scope;
 typedef struct Symbol Symbol;
-typedef struct HashMap HashMap;
 typedef struct DeclSpecifier DeclSpecifier;
 typedef struct Declarator Declarator;
 
@@ -20,20 +22,30 @@ typedef enum
     SYM_FIELD
 } ScopeType;
 
+// 三张符号表都内联在 Scope 中，进入作用域只需一次分配，
+// 真正登记符号时才可能分配 HashMap
 struct Scope
 {
     Scope *parent;
     ScopeType type;
 
-    HashMap *idents;
-    HashMap *tags;
-    HashMap *labels;
+    ScopeTable idents;
+    ScopeTable tags;
+    ScopeTable labels;
 };
 
-Scope *scope_enter(Scope *parent, ScopeType type, size_t count);
+Scope *scope_enter(Scope *parent, ScopeType type);
 
 void scope_free(Scope *scope);
 
-Symbol *identifier_lookup(Scope *scope, const char *name);
-Symbol *tag_lookup(Scope *scope, const char *name);
-Symbol *label_lookup(Scope *scope, const char *name);
+// 符号表以驻留 id (Token.id / intern_id) 为 key，
+// 逐层向外查找时每一层只做整数比较
+
+Symbol *identifier_lookup(Scope *scope, uint32_t id);
+Symbol *tag_lookup(Scope *scope, uint32_t id);
+Symbol *label_lookup(Scope *scope, uint32_t id);
+
+// 在当前作用域登记符号，已存在时返回已有的符号
+Symbol *identifier_insert(Scope *scope, uint32_t id, Symbol *symbol);
+Symbol *tag_insert(Scope *scope, uint32_t id, Symbol *symbol);
+Symbol *label_insert(Scope *scope, uint32_t id, Symbol *symbol);
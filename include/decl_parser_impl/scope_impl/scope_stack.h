@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct Vector Vector;
+typedef struct Symbol Symbol;
+typedef struct ScopeBinding ScopeBinding;
+typedef struct ScopeStack ScopeStack;
+
+// 符号所在的名字空间，三者互不干扰
+typedef enum
+{
+    SNS_IDENT, // 普通标识符 (变量、函数、typedef、枚举常量)
+    SNS_TAG,   // struct / union / enum 的 tag
+    SNS_LABEL, // goto 标签
+    SNS_COUNT
+} ScopeNamespace;
+
+// 一个名字当前可见的绑定
+struct ScopeBinding
+{
+    Symbol *symbol; // 当前可见的符号，NULL 表示未绑定
+    size_t depth;   // 绑定发生时的作用域深度
+};
+
+/**
+ * @brief 扁平作用域栈 (Scope 链的另一种实现)
+ * 每个名字空间只有一张以驻留 id 为下标的全局表，记录每个名字 "当前" 的绑定，
+ * 查找只需一次数组访问，与嵌套深度无关。
+ * 内层作用域遮蔽外层名字时，被覆盖的旧绑定记进撤销日志，
+ * 离开作用域时按日志倒序恢复。
+ *
+ * @note 适合按顺序遍历代码的场景 (解析时边进边出)；
+ * 需要在离开作用域后再回头查询时仍应使用 Scope 链。
+ */
+struct ScopeStack
+{
+    ScopeBinding *bindings[SNS_COUNT]; // bindings[ns][id]
+    size_t capacity[SNS_COUNT];        // 各表能容纳的 id 上界
+    Vector *undo;                      // 撤销日志 (ScopeUndo)
+    Vector *marks;                     // 每层作用域进入时的日志长度 (size_t)
+};
+
+ScopeStack *scope_stack_new(void);
+void scope_stack_free(ScopeStack *ss);
+
+// 进入一层新的作用域
+void scope_stack_enter(ScopeStack *ss);
+
+// 离开当前作用域，撤销其中的所有绑定，恢复被遮蔽的外层绑定
+void scope_stack_leave(ScopeStack *ss);
+
+// 当前嵌套深度，最外层 (文件作用域) 为 0
+size_t scope_stack_depth(const ScopeStack *ss);
+
+/**
+ * @brief 在当前作用域绑定一个名字
+ *
+ * @param ss 进行操作的作用域栈
+ * @param ns 名字空间
+ * @param id 名字的驻留 id
+ * @param symbol 要绑定的符号
+ *
+ * @return Symbol* 当前作用域已经绑定过该名字时返回已有的符号 (不覆盖)，
+ * 否则返回 symbol；失败返回 NULL
+ */
+Symbol *scope_stack_bind(ScopeStack *ss, ScopeNamespace ns, uint32_t id, Symbol *symbol);
+
+/**
+ * @brief 查找名字当前可见的符号
+ *
+ * @return Symbol* 找不到时返回 NULL
+ */
+Symbol *scope_stack_lookup(const ScopeStack *ss, ScopeNamespace ns, uint32_t id);
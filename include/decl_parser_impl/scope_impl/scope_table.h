@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct Symbol Symbol;
+typedef struct HashMap HashMap;
+typedef struct ScopeTable ScopeTable;
+
+// 内联数组能容纳的符号个数，超过后提升为 HashMap
+#define SCOPE_TABLE_INLINE 4
+
+/**
+ * @brief 作用域中的一张符号表 (标识符 / 标签 / struct 等的 tag)
+ * 绝大多数块作用域只声明 0 ~ 3 个名字，
+ * 因此前几个符号直接放在内联数组里线性查找，不做任何分配；
+ * 超过 SCOPE_TABLE_INLINE 个后再整体搬进 HashMap。
+ *
+ * @note 全部清零即为合法的空表。
+ */
+struct ScopeTable
+{
+    uint32_t count;                       // 内联数组中的符号个数
+    uint32_t ids[SCOPE_TABLE_INLINE];     // 符号名的驻留 id
+    Symbol *symbols[SCOPE_TABLE_INLINE];  // 与 ids 一一对应
+    HashMap *map;                         // 提升后的 HashMap，未提升时为 NULL
+};
+
+/**
+ * @brief 在表中查找符号
+ *
+ * @return Symbol* 找到的符号，不存在时返回 NULL
+ */
+Symbol *scope_table_find(const ScopeTable *table, uint32_t id);
+
+/**
+ * @brief 向表中登记符号
+ *
+ * @return Symbol* 已存在时返回已有的符号 (不覆盖)，否则返回 symbol；失败返回 NULL
+ */
+Symbol *scope_table_insert(ScopeTable *table, uint32_t id, Symbol *symbol);
+
+// 释放表占用的内存 (只有提升后的 HashMap)，不释放 Symbol 本身
+void scope_table_clear(ScopeTable *table);
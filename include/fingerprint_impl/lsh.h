@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vector.h"
+
+typedef struct HashMap HashMap;
+typedef struct MinHash MinHash;
+typedef struct LshPair LshPair;
+typedef struct LshIndex LshIndex;
+
+// 一对候选文档，a < b
+struct LshPair
+{
+    uint32_t a;
+    uint32_t b;
+};
+
+// 元素为 LshPair 的 Vector
+VEC_DEFINE(lsh_pair_vec, LshPair)
+
+/**
+ * @brief MinHash 签名的 LSH 分段索引
+ * 把签名切成 bands 段，每段 rows 个桶值；
+ * 每段的桶值哈希后放进该段自己的哈希表，
+ * 只有至少一段完全相同的两个签名才会成为候选对，
+ * 不必两两比较所有签名。
+ *
+ * 两个集合 Jaccard 相似度为 s 时成为候选的概率为 1 - (1 - s^rows)^bands，
+ * 在 s ≈ (1 / bands)^(1 / rows) 附近陡峭上升，这个值就是索引的阈值。
+ *
+ * @note 每段的哈希截成 32 位作为 HashMap 的 id key，
+ * 偶尔的哈希冲突只会多出候选对，不会漏掉真正相同的段；
+ * 候选对应当再用 minhash_similarity 确认。
+ */
+struct LshIndex
+{
+    size_t bands;      // 段数
+    size_t rows;       // 每段的桶数，bands * rows 不超过 MINHASH_SIZE
+    size_t count;      // 已加入的签名个数，文档编号为加入顺序 0, 1, 2 ...
+    HashMap **buckets; // buckets[band]：段哈希 -> 同一桶内最后加入的链表节点 (下标 + 1)
+    Vector *links;     // 所有桶共用的链表节点 (LshLink)
+};
+
+/**
+ * @brief 创建 LSH 索引
+ *
+ * @param bands 段数
+ * @param rows 每段的桶数
+ *
+ * @return LshIndex* 新的索引；bands / rows 为 0 或 bands * rows 超过 MINHASH_SIZE 时返回 NULL
+ */
+LshIndex *lsh_index_new(size_t bands, size_t rows);
+void lsh_index_free(LshIndex *idx);
+
+/**
+ * @brief 为目标 Jaccard 阈值选择段数和行数
+ * 在 bands * rows <= MINHASH_SIZE 的组合中，
+ * 选 (1 / bands)^(1 / rows) 最接近 threshold 的一组。
+ *
+ * @param threshold 目标阈值，范围 (0, 1)
+ * @param bands 输出段数
+ * @param rows 输出每段的桶数
+ */
+void lsh_params_for_threshold(double threshold, size_t *bands, size_t *rows);
+
+/**
+ * @brief 加入一个签名
+ *
+ * @return uint32_t 分配给该签名的文档编号；内存不足时返回 UINT32_MAX，
+ * 此时编号已被占用，签名可能只放入了部分段的桶
+ *
+ * @note 空签名 (见 minhash_is_empty) 同样分配编号，但不放入任何桶，
+ * 因此不会出现在候选对和查询结果中。
+ */
+uint32_t lsh_index_add(LshIndex *idx, const MinHash *mh);
+
+/**
+ * @brief 查询与 mh 至少有一段相同的已加入文档
+ *
+ * @param idx 进行查询的索引
+ * @param mh 要查询的签名
+ * @param out 结果追加到其尾部 (uint32_t 文档编号，升序且不重复)
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note mh 为空签名时没有结果。
+ */
+int lsh_index_query(LshIndex *idx, const MinHash *mh, Vector *out);
+
+/**
+ * @brief 列出所有候选对
+ *
+ * @param idx 进行操作的索引
+ * @param out 结果追加到其尾部 (LshPair，按 (a, b) 升序且不重复)
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 耗时与共享桶内的文档对数成正比，而不是与文档总数的平方成正比。
+ */
+int lsh_index_candidates(LshIndex *idx, Vector *out);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct NGram NGram;
+typedef struct MinHash MinHash;
+
+#define MINHASH_BITS 7                    // 桶个数的位数
+#define MINHASH_SIZE (1u << MINHASH_BITS) // 签名长度 (桶个数)
+#define MINHASH_EMPTY UINT32_MAX          // 没有任何 N-Gram 落入的空桶
+
+/**
+ * @brief 一组 N-Gram 哈希的 MinHash 签名
+ * 使用一次置换哈希 (one-permutation hashing)：
+ * 每个 N-Gram 哈希的最高 MINHASH_BITS 位选桶，低 32 位作为值，桶内只保留最小值。
+ * 每个 N-Gram 只需一次哈希 (就是 NGram::hash 本身)，而不是 MINHASH_SIZE 次。
+ *
+ * 两个签名对应桶相等的比例即两个集合 Jaccard 相似度的估计。
+ *
+ * @note N-Gram 较少时会有空桶，minhash_finish 用 "最优致密化"
+ * 从别的非空桶借值填满，借用的顺序只与桶下标有关，
+ * 因此不同集合的签名仍然可以直接比较。
+ */
+struct MinHash
+{
+    uint32_t v[MINHASH_SIZE];
+};
+
+// 清空签名，所有桶置为 MINHASH_EMPTY
+void minhash_init(MinHash *mh);
+
+/**
+ * @brief 把 count 个 N-Gram 加入签名
+ *
+ * @param mh 进行操作的签名
+ * @param grams N-Gram 数组，如 ngram_vec_data(vec)
+ * @param count N-Gram 个数
+ *
+ * @note 可以分多次调用，结果与一次全部加入相同。
+ * 只看 NGram::hash，重复的 N-Gram 不影响结果。
+ */
+void minhash_add(MinHash *mh, const NGram *grams, size_t count);
+
+// 致密化：所有 N-Gram 加入完毕后调用一次，填满空桶；完全为空的签名保持不变
+void minhash_finish(MinHash *mh);
+
+/**
+ * @brief 签名是否完全为空 (所有桶都是 MINHASH_EMPTY)
+ * 没有任何 N-Gram 的集合 (如符号数不足一个窗口的短文件) 得到的就是空签名。
+ */
+int minhash_is_empty(const MinHash *mh);
+
+// minhash_init + minhash_add + minhash_finish
+void minhash_from_ngrams(MinHash *mh, const NGram *grams, size_t count);
+
+/**
+ * @brief 估计两个签名对应集合的 Jaccard 相似度
+ *
+ * @return double 相等的桶所占比例，范围 [0, 1]；
+ * 任一签名为空时返回 0，空集合之间不视为相似
+ */
+double minhash_similarity(const MinHash *a, const MinHash *b);
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vector.h"
+
+typedef struct NormStream NormStream;
+typedef struct NGram NGram;
+
+/**
+ * @brief 一个 N-Gram 窗口的指纹
+ * 记录窗口内 n 个归一化符号的哈希，以及窗口来自哪个文件的哪个位置。
+ */
+struct NGram
+{
+    uint64_t hash; // 窗口的哈希
+    uint32_t file; // 调用者给的文件编号
+    uint32_t pos;  // 窗口第一个符号在 NormStream 中的下标，字节偏移见 NormStream::offsets
+};
+
+// 元素为 NGram 的 Vector
+VEC_DEFINE(ngram_vec, NGram)
+
+/**
+ * @brief 计算符号流中每个长度为 n 的窗口的哈希
+ * 使用 Rabin-Karp 滚动哈希：窗口右移一格时减去移出的符号、乘底数、加上移入的符号，
+ * 每个窗口 O(1) 更新，总耗时与 n 无关，只与符号个数成正比。
+ *
+ * @param ns 归一化后的符号流
+ * @param n 窗口大小 (符号个数)
+ * @param file 文件编号，原样写入每个 NGram
+ * @param out 结果追加到其尾部 (NGram)，共 ns->size - n + 1 个
+ *
+ * @return int 成功返回 1，否则返回 0；n 为 0 时失败
+ *
+ * @note 符号数少于 n 时没有完整的窗口，不产生任何 NGram。
+ * 同样的 n 个符号无论出现在哪个文件、哪个位置，哈希都相同。
+ */
+int ngram_hashes(const NormStream *ns, size_t n, uint32_t file, Vector *out);
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tokenizer_impl/token.h"
+
+typedef struct Arena Arena;
+typedef struct TokenStream TokenStream;
+typedef struct NormStream NormStream;
+
+// norm_symbol 对需要丢弃的 Token 返回的值
+#define NORM_DROP UINT16_MAX
+
+/**
+ * @brief 归一化后的符号流
+ * 查重只关心代码的 "形状"：标识符一律映射为同一个占位符，
+ * 字面量只保留种类 (数字 / 字符 / 字符串)，预处理指令整行丢弃。
+ * 改名、换常量的 Type-2 克隆因此得到完全相同的符号流。
+ *
+ * 保留下来的 Token 的符号就是它的 TokenType，
+ * 16 位中 TokenType 以上的取值留给以后更细的归一化方式。
+ *
+ * @note syms 与 offsets 平行，offsets[i] 为第 i 个符号对应 Token 在源码中的字节偏移，
+ * 供后面的 N-Gram / 指纹把结果定位回源码。
+ */
+struct NormStream
+{
+    size_t size;       // 符号个数
+    size_t capacity;   // syms / offsets 能容纳的符号个数
+    uint16_t *syms;    // 归一化符号
+    uint32_t *offsets; // 对应 Token 的字节偏移
+    Arena *arena;      // 创建时的活动 Arena (可以为 NULL)，扩容和释放都在其中进行
+};
+
+/**
+ * @brief 创建空的符号流
+ *
+ * @return NormStream* 新的符号流，失败返回 NULL
+ *
+ * @note 记录创建时的活动 Arena，之后的扩容和 norm_stream_free 都使用它，
+ * 因此 ns 可以跨越 arena_use 的切换反复复用，但不能活得比该 Arena 更久。
+ */
+NormStream *norm_stream_new(void);
+void norm_stream_free(NormStream *ns);
+
+/**
+ * @brief 单个 Token 类型归一化后的符号
+ *
+ * @return uint16_t 需要丢弃的 Token (预处理指令、EOF 等) 返回 NORM_DROP
+ */
+uint16_t norm_symbol(TokenType type);
+
+/**
+ * @brief 把 Token 流归一化到 ns 中
+ * 一遍线性扫描，只读 TokenStream 的 kinds / offsets 两个数组，
+ * 除了容量不足时扩容一次外不做任何分配。
+ *
+ * @param ns 输出位置，原有内容被覆盖
+ * @param ts 要归一化的 Token 流
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 处理多个文件时可以反复复用同一个 ns，容量只增不减。
+ */
+int normalize_tokens(NormStream *ns, const TokenStream *ts);
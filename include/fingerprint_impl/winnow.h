@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "vector.h"
+
+typedef struct NGram NGram;
+
+/**
+ * @brief 用 Winnowing 从 N-Gram 哈希中挑选指纹 (MOSS 的做法)
+ * 在每 w 个相邻哈希组成的窗口中选出最小值，相同时取最靠右的一个，
+ * 连续多个窗口选中同一个哈希时只记录一次。
+ * 用单调队列维护窗口最小值，总耗时 O(count)，与 w 无关。
+ *
+ * 保证：两份代码有一段至少 w + n - 1 个符号完全相同 (n 为 N-Gram 大小) 时，
+ * 它们至少共享一个指纹；短于 n 的相同片段则一定不会被报告。
+ * 指纹个数约为 N-Gram 个数的 2 / (w + 1)。
+ *
+ * @param grams ngram_hashes 得到的 N-Gram 数组，按位置顺序排列
+ * @param count N-Gram 个数
+ * @param w 窗口大小，为 1 时保留全部 N-Gram
+ * @param out 选出的指纹追加到其尾部 (NGram，保留原有的 file / pos)
+ *
+ * @return int 成功返回 1，否则返回 0；w 为 0 时失败
+ *
+ * @note count 小于 w 时整个数组视为一个窗口，仍会选出一个指纹，
+ * 短文件因此不会没有指纹。
+ */
+int winnow(const NGram *grams, size_t count, size_t w, Vector *out);
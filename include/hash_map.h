@@ -1,32 +1,63 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
-typedef struct Vector Vector;
 typedef struct HashEntry HashEntry;
 typedef struct HashMap HashMap;
 
+/**
+ * @brief HashMap 中的一个槽位
+ * 直接内联存放在槽位数组中，不再是单独分配的链表节点。
+ */
 struct HashEntry
 {
-    char *key;
+    char *key;     // 字符串 key (随 Map 一起释放)，以 id 为 key 时为 NULL
+    uint32_t id;   // 整数 key (如驻留表 id)，以字符串为 key 时为 0
+    uint32_t hash; // 缓存的完整 hash，扩容时不必重新计算
     void *value;
-    struct HashEntry *next;
 };
 
+/**
+ * @brief 开放寻址的哈希表 (Swiss Table 风格)
+ * 每个槽位对应一个控制字节：最高位为 1 表示空槽，
+ * 否则低 7 位保存该槽 hash 的低 7 位 (h2)。
+ * 查找时一次加载 16 个控制字节，用 SIMD 同时与 h2 比较，
+ * 只有控制字节匹配的槽位才需要真正比较 key。
+ *
+ * @note 负载超过 7/8 时容量翻倍。
+ * 扩容会移动槽位，之前返回的 HashEntry* 在下一次插入后可能失效。
+ */
 struct HashMap
 {
-    Vector *hashs;
+    uint8_t *ctrl;      // capacity + 16 个控制字节，末尾 16 个是开头的镜像，便于越界读取整组
+    HashEntry *entries; // capacity 个槽位
+    size_t capacity;    // 槽位数，总是 2 的幂且不小于 16
+    size_t size;        // 已使用的槽位数
 };
 
 uint32_t hash_str(const char *str);
 
+// 同 hash_str，但按长度计算，不要求以 '\0' 结尾
+uint32_t hash_str_n(const char *str, size_t len);
+
+/**
+ * @brief 创建一个 HashMap
+ *
+ * @param count 预计的元素个数，仅作为初始容量的提示，为 0 时使用最小容量
+ *
+ * @return HashMap* 新的 HashMap
+ */
 HashMap *make_hash_map(size_t count);
 void hash_map_free(HashMap *map);
 
-HashEntry *make_hash_entry(HashEntry *next, const char *key, void *val);
-void hash_entry_free(HashEntry *entry);
-
 HashEntry *hash_map_find(HashMap *map, const char *key);
-HashEntry *hash_entry_find(HashEntry *entry, const char *key);
 
-HashEntry *hash_map_insert(HashMap *map, const char *key, void *val);
\ No newline at end of file
+// key 已存在时返回已有的槽位，不覆盖 value
+HashEntry *hash_map_insert(HashMap *map, const char *key, void *val);
+
+// === 以整数 id 为 key 的版本 ===
+// 常与 intern_id 配合使用，查找只需比较整数，无需 hash 字符串
+
+HashEntry *hash_map_find_id(HashMap *map, uint32_t id);
+HashEntry *hash_map_insert_id(HashMap *map, uint32_t id, void *val);
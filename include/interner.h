@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 全局标识符驻留表 (String Interner)
+ * 每个不同的标识符在第一次出现时分配一个 32 位 id，之后相同的文本总是得到同一个 id。
+ * Tokenizer 把 id 写进 Token，作用域查找、归一化、指纹计算都可以直接比较整数，
+ * 不必反复 hash 字符串再 strcmp。
+ *
+ * @note id 从 1 开始，0 表示 "没有 id" (非标识符 Token)。
+ * 驻留表跨文件共享，内存直接来自 malloc，不受活动 Arena 影响，
+ * 在 intern_clear 之前一直有效。
+ * 目前不是线程安全的，多线程使用前需要外部加锁。
+ */
+
+/**
+ * @brief 获取一段文本的 id，不存在时分配一个新 id
+ *
+ * @param str 文本起始位置，不要求以 '\0' 结尾
+ * @param len 文本字节数
+ *
+ * @return uint32_t 文本对应的 id，内存不足时返回 0
+ */
+uint32_t intern_id(const char *str, size_t len);
+
+/**
+ * @brief 只查找，不分配新 id
+ *
+ * @return uint32_t 文本对应的 id，未驻留时返回 0
+ */
+uint32_t intern_find(const char *str, size_t len);
+
+/**
+ * @brief 根据 id 取回驻留的文本
+ *
+ * @param id intern_id 返回的 id
+ * @param out_len 输出文本长度，可以为 NULL
+ *
+ * @return const char* 以 '\0' 结尾的文本，id 无效时返回 NULL
+ */
+const char *intern_name(uint32_t id, size_t *out_len);
+
+// 当前已驻留的标识符个数
+size_t intern_count(void);
+
+// 清空驻留表，之前得到的 id 和文本全部失效
+void intern_clear(void);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct SourceFile SourceFile;
+
+/**
+ * @brief 只读的源码缓冲区
+ * 普通文件直接 mmap 到内存，省去一次拷贝，页缓存也能在多个进程间共享；
+ * 管道、标准输入等无法映射的输入退回到逐块读取。
+ *
+ * @note data 以 len 定界，不保证以 '\0' 结尾，
+ * 应当配合 tokenizer_new_n / tokenize_all_n 使用。
+ */
+struct SourceFile
+{
+    const char *data; // 源码内容
+    size_t len;       // 源码字节数
+    int mapped;       // 1 表示 data 来自 mmap，0 表示来自堆内存
+};
+
+/**
+ * @brief 打开并加载一个源文件
+ *
+ * @param path 文件路径，"-" 表示标准输入
+ *
+ * @return SourceFile* 加载好的源码，失败返回 NULL
+ */
+SourceFile *source_file_open(const char *path);
+
+/**
+ * @brief 释放源码缓冲区
+ *
+ * @param sf 进行操作的 SourceFile
+ *
+ * @note 由 data 派生出的 Token 在此之后全部失效。
+ */
+void source_file_close(SourceFile *sf);
@@ -4,26 +4,22 @@
 #include <stddef.h>
 
 typedef struct Vector Vector;
-typedef struct Status Status;
 typedef struct Tokenizer Tokenizer;
 
-typedef struct Status
-{
-    size_t line;
-    size_t col;
-} Status;
-
+// 主循环中只维护字节偏移，行列号由 LineIndex 按需计算
 typedef struct Tokenizer
 {
     const char *src;
     size_t pos;
     size_t len;
-    Status stus;
 } Tokenizer;
 
-// 构造函数：初始化 Tokenizer
+// 构造函数：初始化 Tokenizer，src 需以 '\0' 结尾
 Tokenizer *tokenizer_new(const char *src);
 
+// 同 tokenizer_new，但源码由 len 定界，不要求以 '\0' 结尾 (如 mmap 的文件)
+Tokenizer *tokenizer_new_n(const char *src, size_t len);
+
 // 析构函数：释放 Tokenizer 内存
 void tokenizer_free(Tokenizer *tk);
 
@@ -31,11 +27,19 @@ void tokenizer_free(Tokenizer *tk);
 char peek(Tokenizer *tk);
 
 // 步进：返回当前字符，并将光标向前移动一格
-// 同时负责更新行号和列号
 char advance(Tokenizer *tk);
 
 // === 核心调度逻辑 ===
-// 这是词法分析器的主循环入口
+// 这是词法分析器的主循环入口，
+// 把下一个 Token 直接写入调用者提供的 out
+void next_into(Tokenizer *tk, Token *out);
+
+// 同 next_into，但 Token 由 mem_alloc 分配，需调用 token_free 释放
 Token *next(Tokenizer *tk);
 
-Vector *tokenize_all(const char *src);
\ No newline at end of file
+// 返回的 Token 直接引用 src 中的字符，
+// 调用者需保证 src 在 Token Vector 释放之前一直有效
+Vector *tokenize_all(const char *src);
+
+// 同 tokenize_all，但源码由 len 定界
+Vector *tokenize_all_n(const char *src, size_t len);
\ No newline at end of file
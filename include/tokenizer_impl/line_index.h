@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct LineIndex LineIndex;
+
+/**
+ * @brief 源码的换行偏移表
+ * 记录每一行第一个字节在源码中的偏移，
+ * Token 只保存字节偏移，行号和列号在需要输出时才通过二分查找得到。
+ *
+ * @note 整张表只在真正需要行列信息 (dump、报告) 时才构建，
+ * 词法分析的主循环中不再维护行列号。
+ */
+struct LineIndex
+{
+    size_t *starts; // starts[i] 为第 i + 1 行的起始偏移，starts[0] 恒为 0
+    size_t count;   // 行数
+};
+
+/**
+ * @brief 扫描源码，构建换行偏移表
+ *
+ * @param src 源码缓冲区
+ * @param len 源码长度
+ *
+ * @return LineIndex* 新的偏移表，失败返回 NULL
+ */
+LineIndex *line_index_new(const char *src, size_t len);
+
+void line_index_free(LineIndex *li);
+
+/**
+ * @brief 把字节偏移换算成行号和列号
+ *
+ * @param li 偏移表
+ * @param offset 源码中的字节偏移
+ * @param line 输出行号，从 1 开始
+ * @param col 输出列号，从 1 开始，按字节计数
+ */
+void line_index_locate(const LineIndex *li, size_t offset, size_t *line, size_t *col);
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "vector.h"
+
 // 前向声明，告诉编译器 Tokenizer 是个类型，具体细节在别处
 typedef struct Token Token;
 typedef struct Tokenizer Tokenizer;
@@ -131,20 +134,35 @@ typedef enum
  * @brief Token 结构体
  * 采用 String View (视图) 模式，不拷贝字符串，只记录指针和长度，
  * 极大提高了 Tokenizer 的性能。
+ *
+ * @note str 指向源码缓冲区内部，不以 '\0' 结尾，
+ * 必须配合 len 使用（如 printf("%.*s", (int)t->len, t->str)），
+ * 且源码缓冲区必须比 Token 活得更久。
+ * Token 不保存行列号，需要时用 line_index_locate(li, t->pos, ...) 计算。
  */
 struct Token
 {
-    TokenType type; // 类别
-    char *str;      // Token 原始字符串
-    int line;       // 所在的行号
-    int col;        // 所在的列号
+    TokenType type;  // 类别
+    uint32_t id;     // 标识符的驻留 id (见 interner.h)，其他 Token 为 0
+    const char *str; // Token 在源码中的起始位置（不拷贝）
+    size_t len;      // Token 的字节长度
+    size_t pos;      // Token 在源码中的字节偏移，行列号通过 LineIndex 换算
 };
 
+// 元素为 Token 的 Vector (tokenize_all 的结果)
+VEC_DEFINE(token_vec, Token)
+
 // 获取 Token 类型的字符串名称 (用于调试打印)
 const char *token_name(TokenType tt);
 
+typedef struct LineIndex LineIndex;
+
 // 打印 Token 详细信息
-void print_token(const Token *t);
+// li 为 NULL 时只打印字节偏移
+void print_token(const Token *t, const LineIndex *li);
+
+// 在已有的内存上原地填充一个 Token（不分配内存）
+void build_token(Token *t, Tokenizer *tk, TokenType tt, const char *lit, size_t len);
 
 // 构造一个 Token 的辅助函数
 Token *make_token(Tokenizer *tk, TokenType tt, const char *lit, size_t len);
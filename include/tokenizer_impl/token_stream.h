@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tokenizer_impl/token.h"
+
+typedef struct Vector Vector;
+typedef struct TokenStream TokenStream;
+
+/**
+ * @brief 紧凑的 Token 流 (Structure of Arrays)
+ * 把 Token 的各个字段拆成平行数组：
+ * 只看类型的扫描 (UnitScanner 的绝大部分工作) 只需遍历 1 字节一项的 kinds，
+ * 同样大小的缓存能装下的 Token 数量是 Token 数组的数倍。
+ *
+ * @note offsets / lens 以 32 位保存，因此单个源文件不能超过 4 GiB。
+ */
+struct TokenStream
+{
+    const char *src;   // 源码缓冲区，offsets 相对于它
+    size_t size;       // Token 数量 (包括末尾的 EOF)
+    uint8_t *kinds;    // kinds[i] 为第 i 个 Token 的 TokenType
+    uint32_t *offsets; // 第 i 个 Token 在源码中的字节偏移
+    uint32_t *lens;    // 第 i 个 Token 的字节长度
+    uint32_t *ids;     // 第 i 个 Token 的驻留 id，非标识符为 0
+    uint32_t *match;   // 括号配对表，见 token_stream_match
+};
+
+/**
+ * @brief 把 Token 数组转换成紧凑的 Token 流
+ *
+ * @param tokens tokenize_all 得到的 Token Vector
+ *
+ * @return TokenStream* 新的 Token 流，失败返回 NULL；
+ * Token 数量超过 UINT32_MAX 或任一 Token 的 pos + len 超过 UINT32_MAX 时同样返回 NULL
+ *
+ * @note 只读取 tokens，不接管其所有权。
+ * 构建时顺带做一遍括号配对，结果保存在 match 中。
+ */
+TokenStream *token_stream_new(const Vector *tokens);
+
+void token_stream_free(TokenStream *ts);
+
+/**
+ * @brief 获取第 i 个 Token 的类型
+ *
+ * @return TokenType 越界时返回 T_EOF
+ */
+TokenType token_stream_kind(const TokenStream *ts, size_t i);
+
+/**
+ * @brief 把第 i 个 Token 还原成完整的 Token 结构
+ *
+ * @param ts 进行操作的 Token 流
+ * @param i Token 下标
+ * @param out 输出位置
+ *
+ * @return int 成功返回 1，越界返回 0
+ */
+int token_stream_get(const TokenStream *ts, size_t i, Token *out);
+
+/**
+ * @brief 查找与第 i 个 Token 配对的括号
+ * ()、[]、{} 三类括号各自独立配对，互不影响，
+ * 与按类型分别计数深度的结果一致。
+ *
+ * @param ts 进行操作的 Token 流
+ * @param i 括号所在的下标
+ *
+ * @return size_t 左括号返回对应右括号的下标，没有配对时返回末尾 EOF 的下标；
+ * 右括号返回对应左括号的下标；
+ * 不是括号、没有配对的右括号或越界时返回 i 本身
+ */
+size_t token_stream_match(const TokenStream *ts, size_t i);
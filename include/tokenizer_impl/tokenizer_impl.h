@@ -1,15 +1,29 @@
 #pragma once
 
+#include <stddef.h>
+
 typedef struct Token Token;
 typedef struct Tokenizer Tokenizer;
 
 void skip_comment(Tokenizer *tk);
 void skip_space(Tokenizer *tk);
-Token *tokenize_keyword(Tokenizer *tk);
-Token *tokenize_number(Tokenizer *tk);
-Token *tokenize_char(Tokenizer *tk);
-Token *tokenize_string(Tokenizer *tk);
-Token *tokenize_operator(Tokenizer *tk);
-Token *tokenize_preprocessor(Tokenizer *tk);
-Token *tokenize_eof(Tokenizer *tk);
-Token *tokenize_unknown(Tokenizer *tk);
+void tokenize_keyword(Tokenizer *tk, Token *t);
+void tokenize_number(Tokenizer *tk, Token *t);
+void tokenize_char(Tokenizer *tk, Token *t);
+void tokenize_string(Tokenizer *tk, Token *t);
+void tokenize_operator(Tokenizer *tk, Token *t);
+void tokenize_preprocessor(Tokenizer *tk, Token *t);
+void tokenize_eof(Tokenizer *tk, Token *t);
+void tokenize_unknown(Tokenizer *tk, Token *t);
+
+// === 批量扫描内核 (tokenize_simd.c) ===
+// 按 CPU 支持情况在运行时选择 AVX2 / SSE2 / 标量实现，
+// *_scalar 版本始终可用，主要供测试对照。
+
+// 返回 s 开头连续空白符 (' ', '\t', '\r', '\n') 的字节数
+size_t span_blank(const char *s, size_t n);
+size_t span_blank_scalar(const char *s, size_t n);
+
+// 返回 s[0, n) 中 '\n' 的个数
+size_t count_newlines(const char *s, size_t n);
+size_t count_newlines_scalar(const char *s, size_t n);
@@ -2,22 +2,61 @@
 
 #include <stddef.h>
 
+#include "tokenizer_impl/token.h"
+
 typedef struct Vector Vector;
-typedef struct Token Token;
+typedef struct TokenStream TokenStream;
 typedef struct StatementUnit StatementUnit;
 typedef struct UnitScanner UnitScanner;
 
 struct UnitScanner
 {
-    Vector *tokens;
+    Vector *tokens;      // 完整的 Token，语句单元保存的是其中的区间视图
+    TokenStream *stream; // 紧凑的 Token 流，只看类型时使用
+    Vector *frames;      // scan_unit 的显式栈 (ScanFrame)，代替递归
+    Vector *arenas;      // 并行扫描时各线程的 Arena (Arena *)，随扫描器一起释放
     size_t pos;
+    size_t end;  // 扫描的上界，[end, ...) 一律视为 EOF
+    int overrun; // 是否查看过 end 及之后的 Token
 };
 
+// 接管 tokens；失败 (如源文件超过 4 GiB) 时返回 NULL，tokens 仍归调用者所有
 UnitScanner *unit_scanner_new(Vector *tokens);
 
+// 同时释放 tokens，因此必须在扫描得到的语句单元都不再使用之后调用
 void unit_scanner_free(UnitScanner *us);
 
 Token *peek_token(UnitScanner *us);
 Token *next_token(UnitScanner *us);
 
-StatementUnit *scan_file(UnitScanner *us);
\ No newline at end of file
+// 只需要类型时应优先使用 peek_kind，它只读取 1 字节一项的 kinds 数组
+TokenType peek_kind(UnitScanner *us);
+
+// 查看当前位置之后第 ahead 个 Token 的类型，越界时返回 T_EOF
+TokenType peek_kind_at(UnitScanner *us, size_t ahead);
+
+/**
+ * @brief 从当前的左括号直接跳到与之配对的右括号
+ *
+ * @note 使用 TokenStream 预先算好的配对表，代价为 O(1)；
+ * 没有配对时停在末尾的 EOF，当前不是左括号时不移动。
+ */
+void skip_to_match(UnitScanner *us);
+
+StatementUnit *scan_file(UnitScanner *us);
+
+/**
+ * @brief 多线程版本的 scan_file
+ * 借助括号配对表在顶层的 ';' / '}' 处把 Token 流切成若干块，
+ * 各块在线程池中独立扫描，再按顺序拼接到同一个根 compound 语句中。
+ *
+ * @param us 进行操作的扫描器
+ * @param threads 线程数，0 表示使用在线的 CPU 个数
+ *
+ * @return StatementUnit* 与 scan_file 完全相同的语句树
+ *
+ * @note 某一块的扫描需要越过块的边界时 (例如块尾的 if 后面跟着 else)，
+ * 该块会在拼接时顺序重扫，因此结果总与 scan_file 一致。
+ * 调用时若有活动的 Arena，各线程使用各自的 Arena，由 unit_scanner_free 释放。
+ */
+StatementUnit *scan_file_parallel(UnitScanner *us, size_t threads);
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 
-typedef struct Vector Vector;
+#include "unit_scanner_impl/token_range.h"
+#include "vector.h"
+
 typedef struct StatementUnit StatementUnit;
 
+// 元素为 StatementUnit * 的 Vector
+VEC_DEFINE(unit_vec, StatementUnit *)
+
 typedef enum
 {
     SUT_COMPOUND,     // { ... }
@@ -31,7 +36,7 @@ typedef enum
 
 struct StatementUnit
 {
-    Vector *tokens; // Tokens
+    TokenRange tokens; // 共享 Token 数组中的区间，不拥有其中的 Token
     StatementUnitType type;
 
     union
@@ -103,45 +108,45 @@ struct StatementUnit
     };
 };
 
-StatementUnit *make_compound_statement_unit(Vector *tokens, Vector *units);
-StatementUnit *make_empty_statement_unit(Vector *tokens);
-StatementUnit *make_preprocessor_statement_unit(Vector *tokens);
+StatementUnit *make_compound_statement_unit(TokenRange tokens, Vector *units);
+StatementUnit *make_empty_statement_unit(TokenRange tokens);
+StatementUnit *make_preprocessor_statement_unit(TokenRange tokens);
 
-StatementUnit *make_decl_or_expr_statement_unit(Vector *tokens);
+StatementUnit *make_decl_or_expr_statement_unit(TokenRange tokens);
 
 StatementUnit *make_if_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *cond,
     StatementUnit *then_body,
     StatementUnit *else_body);
 StatementUnit *make_switch_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *expr,
     StatementUnit *body);
-StatementUnit *make_case_statement_unit(Vector *tokens, StatementUnit *expr);
-StatementUnit *make_default_statement_unit(Vector *tokens, int dummy);
+StatementUnit *make_case_statement_unit(TokenRange tokens, StatementUnit *expr);
+StatementUnit *make_default_statement_unit(TokenRange tokens, int dummy);
 
 StatementUnit *make_while_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *cond,
     StatementUnit *body);
 StatementUnit *make_do_while_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *body,
     StatementUnit *cond);
 StatementUnit *make_for_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *init,
     StatementUnit *cond,
     StatementUnit *step,
     StatementUnit *body);
 
-StatementUnit *make_continue_statement_unit(Vector *tokens);
-StatementUnit *make_break_statement_unit(Vector *tokens);
-StatementUnit *make_return_statement_unit(Vector *tokens, StatementUnit *expr);
+StatementUnit *make_continue_statement_unit(TokenRange tokens);
+StatementUnit *make_break_statement_unit(TokenRange tokens);
+StatementUnit *make_return_statement_unit(TokenRange tokens, StatementUnit *expr);
 
-StatementUnit *make_label_statement_unit(Vector *tokens, char *name);
-StatementUnit *make_goto_statement_unit(Vector *tokens, char *name);
+StatementUnit *make_label_statement_unit(TokenRange tokens, char *name);
+StatementUnit *make_goto_statement_unit(TokenRange tokens, char *name);
 
 StatementUnit *statement_unit_copy(StatementUnit *unit);
 
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct Vector Vector;
+typedef struct Token Token;
+typedef struct TokenRange TokenRange;
+
+/**
+ * @brief Token 区间视图
+ * 指向共享 Token 数组中的 [begin, end)，不拷贝也不拥有其中的 Token。
+ * 嵌套的 StatementUnit 各自保存一个视图，
+ * 整棵语句树只需要一份 Token 数组。
+ *
+ * @note 视图的生命周期不能超过底层的 Token 数组；
+ * vec 为 NULL 表示空视图。
+ */
+struct TokenRange
+{
+    Vector *vec;  // 底层 Token 数组 (Token)
+    size_t begin; // 起始下标 (包含)
+    size_t end;   // 结束下标 (不包含)
+};
+
+/**
+ * @brief 创建 Token 区间视图
+ *
+ * @param vec 底层 Token 数组
+ * @param begin 区间开始的下标
+ * @param end 区间结束的下标
+ *
+ * @return TokenRange 区间 [begin, end) 的视图
+ *
+ * @note 与 vector_slice 一致，
+ * 区间为空或越界时返回空视图。
+ */
+TokenRange make_token_range(Vector *vec, size_t begin, size_t end);
+
+// 覆盖整个数组的视图，数组为空时同样有效 (vec 不为 NULL)
+TokenRange token_range_all(Vector *vec);
+
+/**
+ * @brief 截取视图中的子区间
+ *
+ * @param range 原视图
+ * @param begin 相对于 range 的起始下标
+ * @param end 相对于 range 的结束下标
+ *
+ * @return TokenRange 子区间视图，规则同 make_token_range
+ */
+TokenRange token_range_sub(TokenRange range, size_t begin, size_t end);
+
+size_t token_range_size(TokenRange range);
+
+/**
+ * @brief 获取视图中的第 idx 个 Token
+ *
+ * @return Token* 越界时返回 NULL
+ */
+Token *token_range_get(TokenRange range, size_t idx);
@@ -1,7 +1,62 @@
 #pragma once
 
+#include <stddef.h>
+
+#include "unit_scanner_impl/statement_unit.h"
+
 typedef struct StatementUnit StatementUnit;
 typedef struct UnitScanner UnitScanner;
+typedef struct ScanFrame ScanFrame;
+
+// 复合语句扫描到一半时的下一步动作
+typedef enum
+{
+    SCAN_DONE,     // 语句已扫描完毕 (结果可能为 NULL)
+    SCAN_UNIT,     // 需要先扫描一个子语句
+    SCAN_COMPOUND, // 需要先扫描一个子语句，且它只能是 { ... }
+} ScanStep;
+
+/**
+ * @brief 显式栈中的一帧
+ * 记录一个已经扫描了开头、正在等待子语句的复合语句 (compound / if / switch / 循环)。
+ * scan_unit 用显式栈代替递归，嵌套深度只受堆内存限制。
+ */
+struct ScanFrame
+{
+    StatementUnitType type;
+    int stage;           // 已经收到的子语句个数
+    size_t pos;          // 语句的起始位置
+    size_t unit_pos;     // 当前子语句开始扫描时的位置 (compound)
+    Vector *units;       // 已扫描的子语句 (compound)
+    StatementUnit *cond; // if / while / do-while / for 的条件，switch 的表达式
+    StatementUnit *init; // for 的初始化部分
+    StatementUnit *step; // for 的步进部分
+    StatementUnit *body; // if 的 then 分支，do-while 的循环体
+};
+
+// 元素为 ScanFrame 的 Vector (UnitScanner::frames)
+VEC_DEFINE(frame_vec, ScanFrame)
+
+/**
+ * 每种复合语句提供一对函数：
+ * xxx_begin 从语句的第一个 Token 开始扫描，直到需要子语句为止，并初始化 frame；
+ * xxx_resume 接收扫描好的子语句 child，继续扫描。
+ * 两者返回 SCAN_DONE 时，扫描结果写入 out。
+ */
+ScanStep scan_compound_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_compound_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
+
+ScanStep scan_if_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_if_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
+ScanStep scan_switch_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_switch_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
+
+ScanStep scan_while_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_while_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
+ScanStep scan_do_while_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_do_while_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
+ScanStep scan_for_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out);
+ScanStep scan_for_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out);
 
 StatementUnit *scan_unit(UnitScanner *us);
 StatementUnit *scan_identifier(UnitScanner *us);
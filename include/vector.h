@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct Vector Vector;
@@ -19,6 +20,7 @@ struct Vector
     size_t size;     // 当前元素个数
     size_t capacity; // 当前分配的容量
     size_t ele_size; // 单个元素的大小 (字节)
+    size_t inline_cap; // 紧跟在结构体后的内联存储能容纳的元素个数
 };
 
 /**
@@ -34,6 +36,21 @@ struct Vector
  */
 Vector *vector_new(size_t ele_size);
 
+/**
+ * @brief 创建一个带内联存储的 Vector
+ * 结构体与前 inline_cap 个元素的存储一次分配，
+ * 元素个数超过 inline_cap 时才另外分配堆内存。
+ *
+ * @param ele_size 元素的字节大小
+ * @param inline_cap 内联存储能容纳的元素个数
+ *
+ * @return 返回一个新的 Vector
+ *
+ * @note 适合大多数时候只有 0~3 个元素的子节点列表，
+ * 其余接口与普通 Vector 完全相同。
+ */
+Vector *vector_new_small(size_t ele_size, size_t inline_cap);
+
 /**
  * @brief 释放 Vector 内存
  *
@@ -72,9 +89,34 @@ Vector *vector_slice(Vector *vec, size_t begin, size_t end);
  * @note 不会进行内存填充，
  * Vector 的 size 也不会改变，
  * 只改变了 capacity。
+ * 容量至少翻倍，反复小幅 reserve 时均摊仍为线性。
  */
 int vector_reserve(Vector *vec, size_t new_cap);
 
+/**
+ * @brief 同 vector_reserve，但容量恰好扩到 new_cap，不多预留
+ *
+ * @param vec 进行操作的 Vector
+ * @param new_cap 新的容量
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 适合事先知道最终大小的场景。
+ */
+int vector_reserve_exact(Vector *vec, size_t new_cap);
+
+/**
+ * @brief 释放多余的容量，使 capacity 等于 size
+ *
+ * @param vec 进行操作的 Vector
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 带内联存储的 Vector 放得下时会搬回内联存储。
+ * 适合构建完毕后长期保存的数组，元素指针会失效。
+ */
+int vector_shrink_to_fit(Vector *vec);
+
 /**
  * @brief 调整大小，
  * 确保 vector 一定有 new_size 个元素，
@@ -102,6 +144,45 @@ int vector_resize(Vector *vec, size_t new_size);
  */
 int vector_push_back(Vector *vec, void *elem);
 
+/**
+ * @brief 向 Vector 尾部一次追加 n 个元素
+ *
+ * @param vec 进行操作的 Vector
+ * @param elems 指向 n 个连续元素的指针
+ * @param n 元素个数
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 最多扩容一次，元素用一次 memcpy 拷入。
+ */
+int vector_append_n(Vector *vec, const void *elems, size_t n);
+
+/**
+ * @brief 把 src 的全部元素追加到 vec 尾部
+ *
+ * @param vec 进行操作的 Vector
+ * @param src 元素来源，ele_size 必须与 vec 相同，可以是 vec 自身
+ *
+ * @return int 成功返回 1，否则返回 0
+ *
+ * @note 浅拷贝，src 本身不变。
+ */
+int vector_extend_from(Vector *vec, Vector *src);
+
+/**
+ * @brief 在 Vector 尾部原地追加一个元素，
+ * 如果容量不足，会自动翻倍扩容。
+ *
+ * @param vec 进行操作的 Vector
+ *
+ * @return void* 指向新元素的指针，失败返回 NULL
+ *
+ * @note 新元素的内存未初始化，由调用者直接填充，
+ * 从而避免先构造临时对象再 memcpy 进来。
+ * 返回的指针在下一次扩容后失效。
+ */
+void *vector_emplace_back(Vector *vec);
+
 /**
  * @brief 移除 Vector 尾部元素，
  * 并释放元素内存。
@@ -166,4 +247,53 @@ int vector_insert(Vector *vec, size_t idx, void *elem);
  *
  * @return int 成功返回 1，否则返回 0
  */
-int vector_remove(Vector *vec, size_t idx);
\ No newline at end of file
+int vector_remove(Vector *vec, size_t idx);
+
+/**
+ * @brief 为元素类型 T 生成一组类型化的 Vector 访问函数
+ * 生成的函数以 name 为前缀，直接操作普通的 Vector，
+ * 元素大小在编译期确定，下标访问编译为普通的指针运算。
+ *
+ * 如 VEC_DEFINE(unit_vec, StatementUnit *) 生成
+ * unit_vec_new / unit_vec_data / unit_vec_at / unit_vec_ptr /
+ * unit_vec_back / unit_vec_push / unit_vec_pop。
+ *
+ * @note 与 vector_get 不同，这些函数不检查 NULL 和越界，
+ * 调用者需保证 ele_size == sizeof(T) 且下标有效。
+ * 同一个 name 只能在一个头文件中定义。
+ */
+#define VEC_DEFINE(name, T)                                         \
+    static inline Vector *name##_new(void)                          \
+    {                                                               \
+        return vector_new(sizeof(T));                               \
+    }                                                               \
+    static inline T *name##_data(const Vector *vec)                 \
+    {                                                               \
+        return (T *)vec->data;                                      \
+    }                                                               \
+    static inline T name##_at(const Vector *vec, size_t idx)        \
+    {                                                               \
+        return ((T *)vec->data)[idx];                               \
+    }                                                               \
+    static inline T *name##_ptr(const Vector *vec, size_t idx)      \
+    {                                                               \
+        return (T *)vec->data + idx;                                \
+    }                                                               \
+    static inline T name##_back(const Vector *vec)                  \
+    {                                                               \
+        return ((T *)vec->data)[vec->size - 1];                     \
+    }                                                               \
+    /* 容量足够时直接赋值，否则交给 vector_push_back 扩容 */        \
+    static inline int name##_push(Vector *vec, T elem)              \
+    {                                                               \
+        if (vec->size < vec->capacity)                              \
+        {                                                           \
+            ((T *)vec->data)[vec->size++] = elem;                   \
+            return 1;                                               \
+        }                                                           \
+        return vector_push_back(vec, &elem);                        \
+    }                                                               \
+    static inline T name##_pop(Vector *vec)                         \
+    {                                                               \
+        return ((T *)vec->data)[--vec->size];                       \
+    }
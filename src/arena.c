@@ -0,0 +1,159 @@
+#include "arena.h"
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+#define ARENA_ALIGN (alignof(max_align_t))
+
+// 当前线程的活动 Arena
+static _Thread_local Arena *current_arena = NULL;
+
+static size_t align_up(size_t n)
+{
+    return (n + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+static ArenaBlock *make_arena_block(ArenaBlock *next, size_t size)
+{
+    ArenaBlock *block = malloc(sizeof(*block) + size);
+    if (!block)
+        return NULL;
+    block->next = next;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+Arena *arena_new(size_t block_size)
+{
+    Arena *arena = malloc(sizeof(*arena));
+    if (!arena)
+        return NULL;
+
+    arena->head = NULL;
+    arena->block_size = align_up(block_size ? block_size : ARENA_DEFAULT_BLOCK_SIZE);
+    arena->last = NULL;
+    arena->last_block = NULL;
+
+    return arena;
+}
+
+void arena_free(Arena *arena)
+{
+    if (!arena)
+        return;
+    if (current_arena == arena)
+        current_arena = NULL;
+
+    ArenaBlock *block = arena->head;
+    while (block)
+    {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+void *arena_alloc(Arena *arena, size_t size)
+{
+    if (!arena)
+        return NULL;
+
+    size = align_up(size ? size : 1);
+
+    ArenaBlock *block = arena->head;
+    if (size > arena->block_size && block)
+    {
+        // 超大对象单独占一个 Block，挂在 head 之后，head 的剩余空间留给后面的小对象
+        block = make_arena_block(arena->head->next, size);
+        if (!block)
+            return NULL;
+        arena->head->next = block;
+    }
+    else if (!block || block->size - block->used < size)
+    {
+        size_t block_size = size > arena->block_size ? size : arena->block_size;
+        block = make_arena_block(arena->head, block_size);
+        if (!block)
+            return NULL;
+        arena->head = block;
+    }
+
+    void *p = block->data + block->used;
+    block->used += size;
+    arena->last = p;
+    arena->last_block = block;
+    return p;
+}
+
+Arena *arena_use(Arena *arena)
+{
+    Arena *prev = current_arena;
+    current_arena = arena;
+    return prev;
+}
+
+Arena *arena_current(void) { return current_arena; }
+
+void *mem_alloc(size_t size)
+{
+    if (current_arena)
+        return arena_alloc(current_arena, size);
+    return malloc(size);
+}
+
+void *mem_calloc(size_t count, size_t size)
+{
+    if (!current_arena)
+        return calloc(count, size);
+
+    if (size && count > SIZE_MAX / size)
+        return NULL;
+    void *p = arena_alloc(current_arena, count * size);
+    if (p)
+        memset(p, 0, count * size);
+    return p;
+}
+
+void *mem_realloc(void *ptr, size_t old_size, size_t new_size)
+{
+    Arena *arena = current_arena;
+    if (!arena)
+        return realloc(ptr, new_size);
+    if (!ptr)
+        return arena_alloc(arena, new_size);
+
+    // 最近一次的分配位于其 Block 的末尾，可以直接原地扩展
+    ArenaBlock *block = arena->last_block;
+    if (ptr == arena->last)
+    {
+        size_t offset = (char *)ptr - block->data;
+        size_t need = align_up(new_size ? new_size : 1);
+        if (need <= block->size - offset)
+        {
+            block->used = offset + need;
+            return ptr;
+        }
+    }
+
+    if (new_size <= old_size)
+        return ptr;
+
+    void *p = arena_alloc(arena, new_size);
+    if (!p)
+        return NULL;
+    memcpy(p, ptr, old_size);
+    return p;
+}
+
+void mem_free(void *ptr)
+{
+    // Arena 中的内存随 arena_free 一起释放
+    if (current_arena)
+        return;
+    free(ptr);
+}
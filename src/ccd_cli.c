@@ -1,17 +1,30 @@
 #include "ccd_cli.h"
+#include "source_file.h"
 #include "tokenizer.h"
+#include "tokenizer_impl/line_index.h"
+#include "tokenizer_impl/token_stream.h"
+#include "fingerprint_impl/normalize.h"
+#include "fingerprint_impl/ngram.h"
+#include "fingerprint_impl/winnow.h"
 #include "unit_scanner.h"
 #include "unit_scanner_impl/statement_unit.h"
 #include "vector.h"
+#include "arena.h"
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// -F 使用的 N-Gram 大小与 Winnowing 窗口，
+// 至少 FP_NGRAM + FP_WINDOW - 1 个符号的相同片段一定会被发现
+#define FP_NGRAM 8
+#define FP_WINDOW 8
+
 void parse_args(int argc, char **argv, CompileOptions *opt)
 {
     opt->stage = STAGE_TOKENS; // 默认行为你可以自己定
     opt->input = NULL;
+    opt->jobs = 1;
 
     for (int i = 1; i < argc; i++)
     {
@@ -19,9 +32,26 @@ void parse_args(int argc, char **argv, CompileOptions *opt)
             opt->stage = STAGE_TOKENS;
         else if (strcmp(argv[i], "-U") == 0)
             opt->stage = STAGE_UNITS;
+        else if (strcmp(argv[i], "-N") == 0)
+            opt->stage = STAGE_NORM;
+        else if (strcmp(argv[i], "-F") == 0)
+            opt->stage = STAGE_FP;
         else if (strcmp(argv[i], "-A") == 0)
             opt->stage = STAGE_AST;
-        else if (argv[i][0] == '-')
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            // -jN 或 -j N
+            const char *num = argv[i][2] ? argv[i] + 2 : (i + 1 < argc ? argv[++i] : "");
+            char *end;
+            unsigned long jobs = strtoul(num, &end, 10);
+            if (*num == '\0' || *end != '\0')
+            {
+                fprintf(stderr, "Invalid job count: %s\n", num);
+                exit(1);
+            }
+            opt->jobs = (size_t)jobs;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
         {
             fprintf(stderr, "Unknown option: %s\n", argv[i]);
             exit(1);
@@ -32,77 +62,119 @@ void parse_args(int argc, char **argv, CompileOptions *opt)
 
     if (!opt->input)
     {
-        fprintf(stderr, "Usage: ccd_cli [-E|-U|-A] file.c\n");
+        fprintf(stderr, "Usage: ccd_cli [-E|-U|-N|-F|-A] [-j N] file.c ('-' for stdin)\n");
         exit(1);
     }
 }
 
-char *read_file(const char *path, size_t *out_len)
+Vector *load_and_tokenize(const char *path, SourceFile **out_src)
 {
-    FILE *f = fopen(path, "rb");
-    if (!f)
+    SourceFile *src = source_file_open(path);
+    if (!src)
     {
         fprintf(stderr, "Error: cannot open file: %s\n", path);
         exit(1);
     }
 
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    rewind(f);
-
-    char *buf = malloc((size_t)size + 1);
-    if (!buf)
+    // 源码由长度定界，无需 '\0' 结尾，也不必再 strlen 一遍
+    Vector *tokens = tokenize_all_n(src->data, src->len);
+    if (!tokens)
     {
-        fprintf(stderr, "Error: out of memory\n");
+        fprintf(stderr, "Tokenization failed\n");
         exit(1);
     }
 
-    size_t n = fread(buf, 1, size, f);
-    fclose(f);
-
-    buf[n] = '\0';
-    if (out_len)
-        *out_len = n;
-    return buf;
+    if (out_src)
+        *out_src = src;
+    else
+        source_file_close(src);
+    return tokens;
 }
 
-Vector *load_and_tokenize(const char *path)
+void dump_tokens(Vector *tokens, const SourceFile *src)
 {
-    size_t len;
-    char *src = read_file(path, &len);
+    // 行列号只在输出时才需要，这里一次性建好换行偏移表
+    LineIndex *li = line_index_new(src->data, src->len);
 
-    Vector *tokens = tokenize_all(src);
-    if (!tokens)
+    for (size_t i = 0; i < tokens->size; i++)
     {
-        fprintf(stderr, "Tokenization failed\n");
-        exit(1);
+        Token *t = token_vec_ptr(tokens, i);
+
+        size_t line, col;
+        line_index_locate(li, t->pos, &line, &col);
+        printf("%4zu:%-4zu  %-12s  \"",
+               line, col, token_name(t->type));
+        if (t->str)
+            fwrite(t->str, 1, t->len, stdout);
+        printf("\"\n");
+
+        if (t->type == T_EOF)
+            break;
     }
-    return tokens;
+
+    line_index_free(li);
 }
 
-void dump_tokens(Vector *tokens)
+void dump_normalized(Vector *tokens, const SourceFile *src)
 {
-    for (size_t i = 0; i < tokens->size; i++)
+    TokenStream *ts = token_stream_new(tokens);
+    NormStream *ns = norm_stream_new();
+    if (!ts || !ns || !normalize_tokens(ns, ts))
     {
-        Token *t = vector_get(tokens, i);
+        fprintf(stderr, "Normalization failed\n");
+        norm_stream_free(ns);
+        token_stream_free(ts);
+        return;
+    }
 
-        printf("%4d:%-4d  %-12s  \"",
-               t->line, t->col, token_name(t->type));
-        fwrite(t->str, 1, strlen(t->str), stdout);
-        printf("\"\n");
+    LineIndex *li = line_index_new(src->data, src->len);
+    for (size_t i = 0; i < ns->size; i++)
+    {
+        size_t line, col;
+        line_index_locate(li, ns->offsets[i], &line, &col);
+        printf("%4zu:%-4zu  %s\n", line, col, token_name((TokenType)ns->syms[i]));
+    }
 
-        if (t->type == T_EOF)
-            break;
+    line_index_free(li);
+    norm_stream_free(ns);
+    token_stream_free(ts);
+}
+
+void dump_fingerprints(Vector *tokens, const SourceFile *src)
+{
+    TokenStream *ts = token_stream_new(tokens);
+    NormStream *ns = norm_stream_new();
+    Vector *grams = ngram_vec_new(), *fps = ngram_vec_new();
+    if (!ts || !ns || !grams || !fps || !normalize_tokens(ns, ts) ||
+        !ngram_hashes(ns, FP_NGRAM, 0, grams) ||
+        !winnow(ngram_vec_data(grams), grams->size, FP_WINDOW, fps))
+        fprintf(stderr, "Fingerprinting failed\n");
+    else
+    {
+        LineIndex *li = line_index_new(src->data, src->len);
+        for (size_t i = 0; i < fps->size; i++)
+        {
+            NGram g = ngram_vec_at(fps, i);
+            size_t line, col;
+            line_index_locate(li, ns->offsets[g.pos], &line, &col);
+            printf("%4zu:%-4zu  %016llx\n", line, col, (unsigned long long)g.hash);
+        }
+        line_index_free(li);
     }
+
+    vector_free(fps);
+    vector_free(grams);
+    norm_stream_free(ns);
+    token_stream_free(ts);
 }
 
-void dump_units(Vector *tokens)
+void dump_units(Vector *tokens, size_t jobs)
 {
     UnitScanner *us = unit_scanner_new(tokens);
     if (!us)
         return;
 
-    StatementUnit *root = scan_file(us);
+    StatementUnit *root = jobs == 1 ? scan_file(us) : scan_file_parallel(us, jobs);
     if (root)
     {
         print_statement_unit(root, 0);
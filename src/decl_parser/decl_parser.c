@@ -5,18 +5,19 @@
 #include "unit_scanner_impl/statement_unit.h"
 #include "tokenizer_impl/token.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Token *peek_token_in_stmt(StatementUnit *stmt, size_t pos)
 {
-    if (!stmt || !stmt->tokens || stmt->tokens->size <= pos)
+    if (!stmt)
         return NULL;
-    return (Token *)vector_get(stmt->tokens, pos);
+    return token_range_get(stmt->tokens, pos);
 }
 
 DeclParser *decl_parser_new(Vector *stmts)
 {
-    DeclParser *p = malloc(sizeof(*p));
+    DeclParser *p = mem_alloc(sizeof(*p));
     p->stmts = stmts;
     p->stmt_pos = 0;
     p->token_pos = 0;
@@ -30,24 +31,24 @@ void decl_parser_free(DeclParser *dp)
     if (dp->stmts)
     {
         for (size_t idx = 0; idx < dp->stmts->size; ++idx)
-            statement_unit_free(*((StatementUnit **)vector_get(dp->stmts, idx)));
+            statement_unit_free(unit_vec_at(dp->stmts, idx));
         vector_free(dp->stmts);
     }
-    free(dp);
+    mem_free(dp);
 }
 
 StatementUnit *peek_statement(DeclParser *dp)
 {
     if (!dp || !dp->stmts || dp->stmt_pos >= dp->stmts->size)
         return NULL;
-    return *((StatementUnit **)vector_get(dp->stmts, dp->stmt_pos));
+    return unit_vec_at(dp->stmts, dp->stmt_pos);
 }
 StatementUnit *next_statement(DeclParser *dp)
 {
     if (!dp || !dp->stmts || dp->stmt_pos >= dp->stmts->size)
         return NULL;
     dp->token_pos = 0;
-    return *((StatementUnit **)vector_get(dp->stmts, dp->stmt_pos++));
+    return unit_vec_at(dp->stmts, dp->stmt_pos++);
 }
 
 Vector *parse_file_decl(DeclParser *dp)
@@ -77,16 +78,16 @@ Vector *parse_file_decl(DeclParser *dp)
     return units;
 }
 
-int is_in_typedef_table(char *name)
+int is_in_typedef_table(uint32_t id)
 {
-    if (!name)
+    if (!id)
         return 0;
     return 0;
 }
 
-int is_in_sue_table(char *name)
+int is_in_sue_table(uint32_t id)
 {
-    if (!name)
+    if (!id)
         return 0;
     return 0;
 }
@@ -94,16 +95,16 @@ int is_in_sue_table(char *name)
 int is_declaration_statement(StatementUnit *stmt)
 {
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !stmt->tokens)
+        !stmt->tokens.vec)
         return 0;
     Token *t = peek_token_in_stmt(stmt, 0);
 
     switch (t->type)
     {
     case T_IDENTIFIER:
-        if (is_in_sue_table(t->str))
+        if (is_in_sue_table(t->id))
             return 1;
-        else if (is_in_typedef_table(t->str))
+        else if (is_in_typedef_table(t->id))
             return 1;
         else
             return 0;
@@ -144,7 +145,7 @@ DeclUnit *parse_decl_statement(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     DeclSpecifier *spec = parse_decl_specifier(dp);
@@ -2,6 +2,7 @@
 #include "decl_parser_impl/decl_specifier_impl/decl_specifier_impl.h"
 #include "decl_parser_impl/decl_specifier_impl/sue_types.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -13,7 +14,7 @@ DeclSpecifier *make_decl_specifier(
     unsigned qualifiers,
     unsigned modifiers)
 {
-    DeclSpecifier *ds = calloc(1, sizeof(*ds));
+    DeclSpecifier *ds = mem_calloc(1, sizeof(*ds));
 
     ds->builtin_type = builtin_type;
     ds->sue_type = sue_type;
@@ -42,7 +43,7 @@ void decl_specifier_free(DeclSpecifier *ds)
         return;
     case DSUE_NONE:
     default:
-        free(ds);
+        mem_free(ds);
         return;
     }
 }
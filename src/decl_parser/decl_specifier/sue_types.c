@@ -6,12 +6,13 @@
 #include "decl_parser_impl/declarator_impl/declarator_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 DeclStructType *make_decl_struct_type(const char *name, Vector *fields)
 {
-    DeclStructType *dst = malloc(sizeof(*dst));
+    DeclStructType *dst = mem_alloc(sizeof(*dst));
 
     dst->name = str_clone(name);
     dst->is_complete = (fields != 0);
@@ -26,14 +27,14 @@ void decl_struct_type_free(DeclStructType *dst)
     if (!dst)
         return;
     if (dst->name)
-        free(dst->name);
+        mem_free(dst->name);
     if (dst->fields)
     {
         for (size_t idx = 0; idx < dst->fields->size; ++idx)
             decl_field_free(*((DeclField **)vector_get(dst->fields, idx)));
         vector_free(dst->fields);
     }
-    free(dst);
+    mem_free(dst);
 }
 
 void complete_decl_struct_type(DeclStructType *dst, Vector *fields)
@@ -47,7 +48,7 @@ void complete_decl_struct_type(DeclStructType *dst, Vector *fields)
 
 DeclUnionType *make_decl_union_type(const char *name, Vector *fields)
 {
-    DeclUnionType *dut = malloc(sizeof(*dut));
+    DeclUnionType *dut = mem_alloc(sizeof(*dut));
 
     dut->name = str_clone(name);
     dut->is_complete = (fields != 0);
@@ -71,19 +72,19 @@ void decl_union_type_free(DeclUnionType *dut)
     if (!dut)
         return;
     if (dut->name)
-        free(dut->name);
+        mem_free(dut->name);
     if (dut->fields)
     {
         for (size_t idx = 0; idx < dut->fields->size; ++idx)
             decl_field_free(*((DeclField **)vector_get(dut->fields, idx)));
         vector_free(dut->fields);
     }
-    free(dut);
+    mem_free(dut);
 }
 
 DeclEnumType *make_decl_enum_type(const char *name, Vector *items)
 {
-    DeclEnumType *det = malloc(sizeof(*det));
+    DeclEnumType *det = mem_alloc(sizeof(*det));
 
     det->name = str_clone(name);
     det->is_complete = (items != 0);
@@ -107,21 +108,21 @@ void decl_enum_type_free(DeclEnumType *det)
     if (!det)
         return;
     if (det->name)
-        free(det->name);
+        mem_free(det->name);
     if (det->items)
     {
         for (size_t idx = 0; idx < det->items->size; ++idx)
             decl_enum_item_free(*((DeclEnumItem **)vector_get(det->items, idx)));
         vector_free(det->items);
     }
-    free(det);
+    mem_free(det);
 }
 
 DeclField *make_decl_field(DeclSpecifier *spec, Vector *decls)
 {
     if (!spec || !decls)
         return NULL;
-    DeclField *field = calloc(1, sizeof(*field));
+    DeclField *field = mem_calloc(1, sizeof(*field));
 
     field->spec = spec;
     field->decls = decls;
@@ -140,12 +141,12 @@ void decl_field_free(DeclField *df)
             decl_initializer_free(*((DeclInitializer **)vector_get(df->decls, idx)));
         vector_free(df->decls);
     }
-    free(df);
+    mem_free(df);
 }
 
 DeclEnumItem *make_decl_enum_item(const char *name, int has_value, long long value)
 {
-    DeclEnumItem *item = calloc(1, sizeof(*item));
+    DeclEnumItem *item = mem_calloc(1, sizeof(*item));
 
     item->name = str_clone(name);
     item->has_value = has_value;
@@ -160,8 +161,8 @@ void decl_enum_item_free(DeclEnumItem *dei)
     if (!dei)
         return;
     if (dei->name)
-        free(dei->name);
-    free(dei);
+        mem_free(dei->name);
+    mem_free(dei);
 }
 
 void print_decl_field_impl(DeclField *field, int indent)
@@ -9,6 +9,7 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -16,7 +17,7 @@ DeclUnit *make_declaration_decl_unit(DeclSpecifier *spec, Vector *decls)
 {
     if (!spec || !decls)
         return NULL;
-    DeclUnit *unit = malloc(sizeof(*unit));
+    DeclUnit *unit = mem_alloc(sizeof(*unit));
     unit->type = DUT_DELARATION;
 
     unit->decl.spec = spec;
@@ -29,7 +30,7 @@ DeclUnit *make_expression_decl_unit(StatementUnit *origin)
 {
     if (!origin)
         return NULL;
-    DeclUnit *unit = malloc(sizeof(*unit));
+    DeclUnit *unit = mem_alloc(sizeof(*unit));
     unit->type = DUT_EXPRESSION;
 
     unit->expr.origin = origin;
@@ -41,7 +42,7 @@ DeclUnit *make_statement_decl_unit(StatementUnit *stmt)
 {
     if (!stmt)
         return NULL;
-    DeclUnit *unit = malloc(sizeof(*unit));
+    DeclUnit *unit = mem_alloc(sizeof(*unit));
     unit->type = DUT_STATEMENT;
 
     unit->stmt.stmt = stmt;
@@ -60,7 +61,7 @@ void decl_unit_declaration_free(DeclUnit *unit)
             decl_initializer_free(*((DeclInitializer **)vector_get(unit->decl.decls, idx)));
         vector_free(unit->decl.decls);
     }
-    free(unit);
+    mem_free(unit);
 }
 
 void decl_unit_expression_free(DeclUnit *unit)
@@ -68,7 +69,7 @@ void decl_unit_expression_free(DeclUnit *unit)
     if (!unit || unit->type != DUT_EXPRESSION)
         return;
     statement_unit_free(unit->expr.origin);
-    free(unit);
+    mem_free(unit);
 }
 
 void decl_unit_statement_free(DeclUnit *unit)
@@ -76,13 +77,16 @@ void decl_unit_statement_free(DeclUnit *unit)
     if (!unit || unit->type != DUT_STATEMENT)
         return;
     statement_unit_free(unit->stmt.stmt);
-    free(unit);
+    mem_free(unit);
 }
 
 void decl_unit_free(DeclUnit *unit)
 {
     if (!unit)
         return;
+    // Arena 模式下整棵树随 Arena 一起释放，无需递归遍历
+    if (arena_current())
+        return;
     switch (unit->type)
     {
     case DUT_DELARATION:
@@ -95,7 +99,7 @@ void decl_unit_free(DeclUnit *unit)
         decl_unit_statement_free(unit);
         break;
     default:
-        free(unit);
+        mem_free(unit);
         return;
     }
 }
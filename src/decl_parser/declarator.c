@@ -6,12 +6,13 @@
 #include "decl_parser_impl/decl_unit.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 Declarator *make_identifier_declarator(char *name)
 {
-    Declarator *decl = malloc(sizeof(*decl));
+    Declarator *decl = mem_alloc(sizeof(*decl));
     decl->type = DRT_IDENT;
 
     decl->name = str_clone(name);
@@ -21,7 +22,7 @@ Declarator *make_identifier_declarator(char *name)
 
 Declarator *make_pointer_declarator(Declarator *inner, unsigned qualifier)
 {
-    Declarator *decl = malloc(sizeof(*decl));
+    Declarator *decl = mem_alloc(sizeof(*decl));
     decl->type = DRT_POINTER;
 
     decl->name = str_clone(inner ? inner->name : NULL);
@@ -33,7 +34,7 @@ Declarator *make_pointer_declarator(Declarator *inner, unsigned qualifier)
 
 Declarator *make_array_declarator(Declarator *inner, DeclUnit *length)
 {
-    Declarator *decl = malloc(sizeof(*decl));
+    Declarator *decl = mem_alloc(sizeof(*decl));
     decl->type = DRT_ARRAY;
 
     decl->name = str_clone(inner ? inner->name : NULL);
@@ -45,7 +46,7 @@ Declarator *make_array_declarator(Declarator *inner, DeclUnit *length)
 
 Declarator *make_function_declarator(Declarator *inner, Vector *params, int is_variadic)
 {
-    Declarator *decl = malloc(sizeof(*decl));
+    Declarator *decl = mem_alloc(sizeof(*decl));
     decl->type = DRT_FUNCTION;
 
     decl->name = str_clone(inner ? inner->name : NULL);
@@ -58,7 +59,7 @@ Declarator *make_function_declarator(Declarator *inner, Vector *params, int is_v
 
 Declarator *make_group_declarator(Declarator *inner)
 {
-    Declarator *decl = malloc(sizeof(*decl));
+    Declarator *decl = mem_alloc(sizeof(*decl));
     decl->type = DRT_GROUP;
 
     decl->name = str_clone(inner ? inner->name : NULL);
@@ -71,8 +72,11 @@ void declarator_free(Declarator *decl)
 {
     if (!decl)
         return;
+    // Arena 模式下整棵树随 Arena 一起释放，无需递归遍历
+    if (arena_current())
+        return;
     if (decl->name)
-        free(decl->name);
+        mem_free(decl->name);
     switch (decl->type)
     {
     case DRT_POINTER:
@@ -97,7 +101,7 @@ void declarator_free(Declarator *decl)
     default:
         break;
     }
-    free(decl);
+    mem_free(decl);
 }
 
 void print_declarator(Declarator *d)
@@ -6,6 +6,7 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "utils.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -13,7 +14,7 @@ DeclInitializer *make_decl_initializer(Declarator *decl, DeclUnit *init)
 {
     if (!decl || (init && init->type != DUT_EXPRESSION))
         return NULL;
-    DeclInitializer *di = malloc(sizeof(*di));
+    DeclInitializer *di = mem_alloc(sizeof(*di));
     di->decl = decl;
     di->init = init;
 
@@ -26,7 +27,7 @@ void decl_initializer_free(DeclInitializer *di)
         return;
     declarator_free(di->decl);
     decl_unit_free(di->init);
-    free(di);
+    mem_free(di);
 }
 
 void print_decl_initializer(DeclInitializer *di)
@@ -3,13 +3,14 @@
 #include "decl_parser_impl/decl_specifier.h"
 #include "decl_parser_impl/declarator.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 DeclParam *make_decl_param(DeclSpecifier *spec, Declarator *decl)
 {
     if (!spec)
         return NULL;
-    DeclParam *dp = malloc(sizeof(*dp));
+    DeclParam *dp = mem_alloc(sizeof(*dp));
 
     if (decl)
         dp->name = str_clone(decl->name ? decl->name : NULL);
@@ -27,8 +28,8 @@ void decl_param_free(DeclParam *dp)
         return;
 
     if (dp->name)
-        free(dp->name);
+        mem_free(dp->name);
     decl_specifier_free(dp->spec);
     declarator_free(dp->decl);
-    free(dp);
+    mem_free(dp);
 }
\ No newline at end of file
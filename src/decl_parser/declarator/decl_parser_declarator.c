@@ -9,6 +9,7 @@
 #include "tokenizer_impl/token.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Vector *parse_decl_initializer_list(DeclParser *dp)
@@ -17,10 +18,10 @@ Vector *parse_decl_initializer_list(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
-    Vector *list = vector_new(sizeof(DeclInitializer *));
+    Vector *list = vector_new_small(sizeof(DeclInitializer *), 4);
     Token *t = peek_token_in_stmt(stmt, dp->token_pos);
     while (1)
     {
@@ -56,7 +57,7 @@ DeclInitializer *parse_decl_initializer(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Declarator *decl = parse_declarator(dp);
@@ -94,7 +95,7 @@ DeclInitializer *parse_decl_initializer(DeclParser *dp)
                 decl,
                 make_expression_decl_unit(
                     make_decl_or_expr_statement_unit(
-                        vector_slice(
+                        token_range_sub(
                             stmt->tokens,
                             init_start_pos, dp->token_pos))));
         else
@@ -112,7 +113,7 @@ Declarator *parse_declarator(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Vector *ptr_buffer = vector_new(sizeof(unsigned));
@@ -142,7 +143,7 @@ Declarator *parse_declarator(DeclParser *dp)
 //         return NULL;
 //     StatementUnit *stmt = peek_statement(dp);
 //     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-//         !stmt->tokens || !is_declaration_statement(stmt))
+//         !stmt->tokens.vec || !is_declaration_statement(stmt))
 //         return NULL;
 // }
 
@@ -152,7 +153,7 @@ Declarator *parse_direct_declarator(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Declarator *decl = NULL;
@@ -162,9 +163,9 @@ Declarator *parse_direct_declarator(DeclParser *dp)
 
     if (t->type == T_IDENTIFIER)
     {
-        char *str = str_clone(t->str);
+        char *str = str_n_clone(t->str, t->len);
         decl = make_identifier_declarator(str);
-        free(str);
+        mem_free(str);
         dp->token_pos++;
     }
     else if (t->type == T_LEFT_PAREN)
@@ -205,7 +206,7 @@ unsigned parse_pointer_qualifiers(DeclParser *dp)
         return DTQ_NONE;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return DTQ_NONE;
 
     Token *t = peek_token_in_stmt(stmt, dp->token_pos);
@@ -245,7 +246,7 @@ Declarator *parse_array_suffix(DeclParser *dp, Declarator *decl)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Token *t = peek_token_in_stmt(stmt, dp->token_pos);
@@ -279,7 +280,7 @@ Declarator *parse_array_suffix(DeclParser *dp, Declarator *decl)
         outer->array.length =
             make_expression_decl_unit(
                 make_decl_or_expr_statement_unit(
-                    vector_slice(stmt->tokens, len_start, dp->token_pos)));
+                    token_range_sub(stmt->tokens, len_start, dp->token_pos)));
 
     return outer;
 }
@@ -290,14 +291,14 @@ Declarator *parse_function_suffix(DeclParser *dp, Declarator *decl)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Token *t = peek_token_in_stmt(stmt, dp->token_pos);
     if (!t || t->type != T_LEFT_PAREN)
         return NULL;
 
-    Vector *params = vector_new(sizeof(DeclParam *));
+    Vector *params = vector_new_small(sizeof(DeclParam *), 4);
     int is_variadic = 0;
     t = peek_token_in_stmt(stmt, ++dp->token_pos);
 
@@ -357,11 +358,11 @@ Vector *parse_decl_param_list(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     Token *t = peek_token_in_stmt(stmt, dp->token_pos);
-    Vector *params = vector_new(sizeof(DeclParam *));
+    Vector *params = vector_new_small(sizeof(DeclParam *), 4);
     if (t->type == T_RIGHT_PAREN)
         return params;
 
@@ -387,7 +388,7 @@ DeclParam *parse_decl_param(DeclParser *dp)
         return NULL;
     StatementUnit *stmt = peek_statement(dp);
     if (!stmt || stmt->type != SUT_DECL_OR_EXPR ||
-        !stmt->tokens || !is_declaration_statement(stmt))
+        !stmt->tokens.vec || !is_declaration_statement(stmt))
         return NULL;
 
     DeclSpecifier *spec = parse_decl_specifier(dp);
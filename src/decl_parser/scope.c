@@ -1,16 +1,18 @@
 #include "decl_parser_impl/scope.h"
-#include "hash_map.h"
+#include "arena.h"
 #include <stdlib.h>
+#include <string.h>
 
-Scope *scope_enter(Scope *parent, ScopeType type, size_t count)
+Scope *scope_enter(Scope *parent, ScopeType type)
 {
-    Scope *scope = malloc(sizeof(*scope));
+    Scope *scope = mem_alloc(sizeof(*scope));
+    if (!scope)
+        return NULL;
 
+    // 符号表全部清零即为空表，此时不分配任何额外内存
+    memset(scope, 0, sizeof(*scope));
     scope->parent = parent;
     scope->type = type;
-    scope->idents = make_hash_map(count);
-    scope->tags = make_hash_map(count);
-    scope->labels = make_hash_map(count);
 
     return scope;
 }
@@ -19,35 +21,47 @@ void scope_free(Scope *scope)
 {
     if (!scope)
         return;
-    hash_map_free(scope->idents);
-    hash_map_free(scope->tags);
-    hash_map_free(scope->labels);
-    free(scope);
+    scope_table_clear(&scope->idents);
+    scope_table_clear(&scope->tags);
+    scope_table_clear(&scope->labels);
+    mem_free(scope);
+}
+
+Symbol *identifier_lookup(Scope *scope, uint32_t id)
+{
+    Symbol *symbol = NULL;
+    for (Scope *cur = scope; cur && (!symbol); cur = cur->parent)
+        symbol = scope_table_find(&cur->idents, id);
+    return symbol;
 }
 
-Symbol *identifier_lookup(Scope *scope, const char *name)
+Symbol *tag_lookup(Scope *scope, uint32_t id)
 {
-    HashEntry *entry = NULL;
-    for (Scope *cur = scope; cur && (!entry); cur = cur->parent)
-        if (cur->idents)
-            entry = hash_map_find(cur->idents, name);
-    return entry ? (*(Symbol **)entry->value) : NULL;
+    Symbol *symbol = NULL;
+    for (Scope *cur = scope; cur && (!symbol); cur = cur->parent)
+        symbol = scope_table_find(&cur->tags, id);
+    return symbol;
 }
 
-Symbol *tag_lookup(Scope *scope, const char *name)
+Symbol *label_lookup(Scope *scope, uint32_t id)
 {
-    HashEntry *entry = NULL;
-    for (Scope *cur = scope; cur && (!entry); cur = cur->parent)
-        if (cur->tags)
-            entry = hash_map_find(cur->tags, name);
-    return entry ? (*(Symbol **)entry->value) : NULL;
+    Symbol *symbol = NULL;
+    for (Scope *cur = scope; cur && (!symbol); cur = cur->parent)
+        symbol = scope_table_find(&cur->labels, id);
+    return symbol;
 }
 
-Symbol *label_lookup(Scope *scope, const char *name)
+Symbol *identifier_insert(Scope *scope, uint32_t id, Symbol *symbol)
 {
-    HashEntry *entry = NULL;
-    for (Scope *cur = scope; cur && (!entry); cur = cur->parent)
-        if (cur->labels)
-            entry = hash_map_find(cur->labels, name);
-    return entry ? (*(Symbol **)entry->value) : NULL;
-}
\ No newline at end of file
+    return scope ? scope_table_insert(&scope->idents, id, symbol) : NULL;
+}
+
+Symbol *tag_insert(Scope *scope, uint32_t id, Symbol *symbol)
+{
+    return scope ? scope_table_insert(&scope->tags, id, symbol) : NULL;
+}
+
+Symbol *label_insert(Scope *scope, uint32_t id, Symbol *symbol)
+{
+    return scope ? scope_table_insert(&scope->labels, id, symbol) : NULL;
+}
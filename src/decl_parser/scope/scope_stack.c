@@ -0,0 +1,123 @@
+#include "decl_parser_impl/scope_impl/scope_stack.h"
+#include "vector.h"
+#include "arena.h"
+
+#include <string.h>
+
+// 撤销日志中的一条记录：恢复 bindings[ns][id] 为 prev
+typedef struct
+{
+    ScopeNamespace ns;
+    uint32_t id;
+    ScopeBinding prev;
+} ScopeUndo;
+
+ScopeStack *scope_stack_new(void)
+{
+    ScopeStack *ss = mem_alloc(sizeof(*ss));
+    if (!ss)
+        return NULL;
+
+    memset(ss, 0, sizeof(*ss));
+    ss->undo = vector_new(sizeof(ScopeUndo));
+    ss->marks = vector_new(sizeof(size_t));
+    if (!ss->undo || !ss->marks)
+    {
+        scope_stack_free(ss);
+        return NULL;
+    }
+    return ss;
+}
+
+void scope_stack_free(ScopeStack *ss)
+{
+    if (!ss)
+        return;
+    for (int ns = 0; ns < SNS_COUNT; ++ns)
+        mem_free(ss->bindings[ns]);
+    vector_free(ss->undo);
+    vector_free(ss->marks);
+    mem_free(ss);
+}
+
+void scope_stack_enter(ScopeStack *ss)
+{
+    if (!ss)
+        return;
+    size_t mark = ss->undo->size;
+    vector_push_back(ss->marks, &mark);
+}
+
+void scope_stack_leave(ScopeStack *ss)
+{
+    if (!ss || !ss->marks->size)
+        return;
+
+    size_t mark = *(size_t *)vector_back(ss->marks);
+    vector_pop_back(ss->marks);
+
+    // 倒序恢复，同一个名字被多次覆盖时最终回到最早的绑定
+    while (ss->undo->size > mark)
+    {
+        ScopeUndo *u = vector_back(ss->undo);
+        ss->bindings[u->ns][u->id] = u->prev;
+        vector_pop_back(ss->undo);
+    }
+}
+
+size_t scope_stack_depth(const ScopeStack *ss) { return ss ? ss->marks->size : 0; }
+
+// 保证 bindings[ns] 能以 id 为下标访问
+static int ensure_capacity(ScopeStack *ss, ScopeNamespace ns, uint32_t id)
+{
+    size_t old_cap = ss->capacity[ns];
+    if (id < old_cap)
+        return 1;
+
+    size_t cap = old_cap ? old_cap : 256;
+    while (cap <= id)
+        cap *= 2;
+
+    ScopeBinding *nb = mem_realloc(ss->bindings[ns],
+                                   old_cap * sizeof(ScopeBinding),
+                                   cap * sizeof(ScopeBinding));
+    if (!nb)
+        return 0;
+    memset(nb + old_cap, 0, (cap - old_cap) * sizeof(ScopeBinding));
+
+    ss->bindings[ns] = nb;
+    ss->capacity[ns] = cap;
+    return 1;
+}
+
+Symbol *scope_stack_bind(ScopeStack *ss, ScopeNamespace ns, uint32_t id, Symbol *symbol)
+{
+    if (!ss || ns >= SNS_COUNT || !id || !ensure_capacity(ss, ns, id))
+        return NULL;
+
+    size_t depth = ss->marks->size;
+    ScopeBinding *b = &ss->bindings[ns][id];
+
+    // 同一作用域内的重复声明不覆盖
+    if (b->symbol && b->depth == depth)
+        return b->symbol;
+
+    // 文件作用域的绑定永远不会被撤销，无需记录
+    if (depth > 0)
+    {
+        ScopeUndo u = {ns, id, *b};
+        if (!vector_push_back(ss->undo, &u))
+            return NULL;
+    }
+
+    b->symbol = symbol;
+    b->depth = depth;
+    return symbol;
+}
+
+Symbol *scope_stack_lookup(const ScopeStack *ss, ScopeNamespace ns, uint32_t id)
+{
+    if (!ss || ns >= SNS_COUNT || id >= ss->capacity[ns])
+        return NULL;
+    return ss->bindings[ns][id].symbol;
+}
@@ -0,0 +1,67 @@
+#include "decl_parser_impl/scope_impl/scope_table.h"
+#include "hash_map.h"
+
+Symbol *scope_table_find(const ScopeTable *table, uint32_t id)
+{
+    if (!table || !id)
+        return NULL;
+
+    if (table->map)
+    {
+        HashEntry *entry = hash_map_find_id(table->map, id);
+        return entry ? (Symbol *)entry->value : NULL;
+    }
+
+    for (uint32_t i = 0; i < table->count; ++i)
+        if (table->ids[i] == id)
+            return table->symbols[i];
+    return NULL;
+}
+
+// 内联数组已满，把已有的符号整体搬进 HashMap
+static int promote(ScopeTable *table)
+{
+    HashMap *map = make_hash_map(SCOPE_TABLE_INLINE * 4);
+    if (!map)
+        return 0;
+
+    for (uint32_t i = 0; i < table->count; ++i)
+        hash_map_insert_id(map, table->ids[i], table->symbols[i]);
+
+    table->map = map;
+    table->count = 0;
+    return 1;
+}
+
+Symbol *scope_table_insert(ScopeTable *table, uint32_t id, Symbol *symbol)
+{
+    if (!table || !id)
+        return NULL;
+
+    Symbol *exist = scope_table_find(table, id);
+    if (exist)
+        return exist;
+
+    if (!table->map && table->count < SCOPE_TABLE_INLINE)
+    {
+        table->ids[table->count] = id;
+        table->symbols[table->count] = symbol;
+        table->count++;
+        return symbol;
+    }
+
+    if (!table->map && !promote(table))
+        return NULL;
+
+    HashEntry *entry = hash_map_insert_id(table->map, id, symbol);
+    return entry ? (Symbol *)entry->value : NULL;
+}
+
+void scope_table_clear(ScopeTable *table)
+{
+    if (!table)
+        return;
+    hash_map_free(table->map);
+    table->map = NULL;
+    table->count = 0;
+}
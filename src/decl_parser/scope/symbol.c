@@ -3,6 +3,7 @@
 #include "decl_parser_impl/decl_specifier.h"
 #include "decl_parser_impl/declarator.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Symbol *make_symbol(
@@ -13,7 +14,7 @@ Symbol *make_symbol(
 {
     if (!scope || !spec)
         return NULL;
-    Symbol *symbol = malloc(sizeof(*symbol));
+    Symbol *symbol = mem_alloc(sizeof(*symbol));
 
     symbol->type = type;
     symbol->scope = scope;
@@ -33,9 +34,9 @@ void symbol_free(Symbol *symbol)
         return;
 
     if (symbol->name)
-        free(symbol->name);
+        mem_free(symbol->name);
     scope_free(symbol->scope);
     decl_specifier_free(symbol->spec);
     declarator_free(symbol->decl);
-    free(symbol);
+    mem_free(symbol);
 }
\ No newline at end of file
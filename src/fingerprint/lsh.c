@@ -0,0 +1,205 @@
+#include "fingerprint_impl/lsh.h"
+#include "fingerprint_impl/minhash.h"
+#include "hash_map.h"
+#include "arena.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 桶内链表的一个节点，next 为同一桶内上一个节点的下标 + 1，0 表示结尾
+typedef struct
+{
+    uint32_t doc;
+    uint32_t next;
+} LshLink;
+
+VEC_DEFINE(lsh_link_vec, LshLink)
+
+LshIndex *lsh_index_new(size_t bands, size_t rows)
+{
+    if (!bands || !rows || bands * rows > MINHASH_SIZE)
+        return NULL;
+
+    LshIndex *idx = mem_alloc(sizeof(*idx));
+    if (!idx)
+        return NULL;
+    idx->bands = bands;
+    idx->rows = rows;
+    idx->count = 0;
+    idx->links = lsh_link_vec_new();
+    idx->buckets = mem_calloc(bands, sizeof(HashMap *));
+    if (!idx->links || !idx->buckets)
+    {
+        lsh_index_free(idx);
+        return NULL;
+    }
+
+    for (size_t b = 0; b < bands; ++b)
+        if (!(idx->buckets[b] = make_hash_map(0)))
+        {
+            lsh_index_free(idx);
+            return NULL;
+        }
+    return idx;
+}
+
+void lsh_index_free(LshIndex *idx)
+{
+    if (!idx)
+        return;
+    if (idx->buckets)
+        for (size_t b = 0; b < idx->bands; ++b)
+            hash_map_free(idx->buckets[b]);
+    mem_free(idx->buckets);
+    vector_free(idx->links);
+    mem_free(idx);
+}
+
+void lsh_params_for_threshold(double threshold, size_t *bands, size_t *rows)
+{
+    size_t best_b = MINHASH_SIZE, best_r = 1;
+    double best = 2.0;
+    for (size_t r = 1; r <= MINHASH_SIZE; ++r)
+    {
+        // 行数固定时段数越多召回越高，用满签名
+        size_t b = MINHASH_SIZE / r;
+        double diff = fabs(pow(1.0 / (double)b, 1.0 / (double)r) - threshold);
+        if (diff < best)
+        {
+            best = diff;
+            best_b = b;
+            best_r = r;
+        }
+    }
+    *bands = best_b;
+    *rows = best_r;
+}
+
+// 第 band 段的哈希，截成非 0 的 32 位 id
+static uint32_t band_key(const LshIndex *idx, const MinHash *mh, size_t band)
+{
+    const uint32_t *v = mh->v + band * idx->rows;
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < idx->rows; ++i)
+        h = (h ^ v[i]) * 0x100000001B3ull;
+    h ^= h >> 32;
+    return (uint32_t)h ? (uint32_t)h : 1;
+}
+
+uint32_t lsh_index_add(LshIndex *idx, const MinHash *mh)
+{
+    uint32_t doc = (uint32_t)idx->count++;
+
+    // 空签名的每一段都相同，放进桶里会让所有短文件两两成为候选
+    if (minhash_is_empty(mh))
+        return doc;
+
+    for (size_t b = 0; b < idx->bands; ++b)
+    {
+        // 先放入节点，成功后才让桶指向它，桶里不会出现悬空的下标
+        uint32_t link = (uint32_t)idx->links->size + 1;
+        if (!lsh_link_vec_push(idx->links, (LshLink){doc, 0}))
+            return UINT32_MAX;
+
+        HashEntry *e = hash_map_insert_id(idx->buckets[b], band_key(idx, mh, b), (void *)(uintptr_t)link);
+        if (!e)
+        {
+            lsh_link_vec_pop(idx->links);
+            return UINT32_MAX;
+        }
+
+        // 桶已存在时 insert 返回原有的槽位，把新节点接到链表头
+        if (e->value != (void *)(uintptr_t)link)
+        {
+            lsh_link_vec_ptr(idx->links, link - 1)->next = (uint32_t)(uintptr_t)e->value;
+            e->value = (void *)(uintptr_t)link;
+        }
+    }
+    return doc;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_pair(const void *a, const void *b)
+{
+    const LshPair *x = a, *y = b;
+    if (x->a != y->a)
+        return (x->a > y->a) - (x->a < y->a);
+    return (x->b > y->b) - (x->b < y->b);
+}
+
+// 对 vec 中 begin 之后的部分排序去重
+static void sort_unique(Vector *vec, size_t begin, int (*cmp)(const void *, const void *))
+{
+    size_t n = vec->size - begin, ele = vec->ele_size;
+    if (n < 2)
+        return;
+
+    char *base = (char *)vec->data + begin * ele;
+    qsort(base, n, ele, cmp);
+
+    size_t kept = 1;
+    for (size_t i = 1; i < n; ++i)
+        if (cmp(base + (kept - 1) * ele, base + i * ele) != 0)
+            memcpy(base + (kept++) * ele, base + i * ele, ele);
+    vec->size = begin + kept;
+}
+
+int lsh_index_query(LshIndex *idx, const MinHash *mh, Vector *out)
+{
+    if (!idx || !mh || !out || out->ele_size != sizeof(uint32_t))
+        return 0;
+
+    // 空签名不在任何桶里，也不与任何文档相似
+    if (minhash_is_empty(mh))
+        return 1;
+
+    size_t begin = out->size;
+    const LshLink *links = lsh_link_vec_data(idx->links);
+    for (size_t b = 0; b < idx->bands; ++b)
+    {
+        HashEntry *e = hash_map_find_id(idx->buckets[b], band_key(idx, mh, b));
+        for (uint32_t l = e ? (uint32_t)(uintptr_t)e->value : 0; l; l = links[l - 1].next)
+            if (!vector_push_back(out, (void *)&links[l - 1].doc))
+                return 0;
+    }
+
+    sort_unique(out, begin, cmp_u32);
+    return 1;
+}
+
+int lsh_index_candidates(LshIndex *idx, Vector *out)
+{
+    if (!idx || !out || out->ele_size != sizeof(LshPair))
+        return 0;
+
+    size_t begin = out->size;
+    const LshLink *links = lsh_link_vec_data(idx->links);
+    for (size_t b = 0; b < idx->bands; ++b)
+    {
+        HashMap *map = idx->buckets[b];
+        for (size_t s = 0; s < map->capacity; ++s)
+        {
+            // 控制字节最高位为 1 的是空槽；只有一个文档的桶不产生候选
+            if (map->ctrl[s] & 0x80)
+                continue;
+            uint32_t head = (uint32_t)(uintptr_t)map->entries[s].value;
+            if (!links[head - 1].next)
+                continue;
+
+            // 链表按加入顺序倒序，前面的节点文档编号更大
+            for (uint32_t x = head; x; x = links[x - 1].next)
+                for (uint32_t y = links[x - 1].next; y; y = links[y - 1].next)
+                    if (!lsh_pair_vec_push(out, (LshPair){links[y - 1].doc, links[x - 1].doc}))
+                        return 0;
+        }
+    }
+
+    sort_unique(out, begin, cmp_pair);
+    return 1;
+}
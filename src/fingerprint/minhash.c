@@ -0,0 +1,194 @@
+#include "fingerprint_impl/minhash.h"
+#include "fingerprint_impl/ngram.h"
+
+#include <string.h>
+
+// 与 tokenize_simd.c 相同：只有 x86 上的 GCC / Clang 才启用 SIMD 快速路径
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CCD_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define CCD_SIMD_X86 0
+#endif
+
+// 同时维护的部分签名个数。相邻的 N-Gram 写入不同的部分签名，
+// 落到同一个桶时不必等上一次的读-改-写完成
+#define MINHASH_LANES 4
+
+_Static_assert(MINHASH_SIZE % 8 == 0, "MINHASH_SIZE must be a multiple of 8");
+
+// === 逐桶取最小值 / 统计相等的桶 ===
+
+static void merge_min_scalar(uint32_t *dst, const uint32_t *src)
+{
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        if (src[i] < dst[i])
+            dst[i] = src[i];
+}
+
+static size_t count_equal_scalar(const uint32_t *a, const uint32_t *b)
+{
+    size_t cnt = 0;
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        cnt += (a[i] == b[i]);
+    return cnt;
+}
+
+#if CCD_SIMD_X86
+
+// SSE2 没有无符号 32 位 min，从 SSE4.1 开始才有
+__attribute__((target("sse4.1"))) static void merge_min_sse41(uint32_t *dst, const uint32_t *src)
+{
+    for (size_t i = 0; i < MINHASH_SIZE; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_min_epu32(d, s));
+    }
+}
+
+__attribute__((target("sse2"))) static size_t count_equal_sse2(const uint32_t *a, const uint32_t *b)
+{
+    size_t cnt = 0;
+    for (size_t i = 0; i < MINHASH_SIZE; i += 4)
+    {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(a + i)),
+                                     _mm_loadu_si128((const __m128i *)(b + i)));
+        cnt += (size_t)__builtin_popcount((unsigned)_mm_movemask_ps(_mm_castsi128_ps(eq)));
+    }
+    return cnt;
+}
+
+__attribute__((target("avx2"))) static void merge_min_avx2(uint32_t *dst, const uint32_t *src)
+{
+    for (size_t i = 0; i < MINHASH_SIZE; i += 8)
+    {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_min_epu32(d, s));
+    }
+}
+
+__attribute__((target("avx2"))) static size_t count_equal_avx2(const uint32_t *a, const uint32_t *b)
+{
+    size_t cnt = 0;
+    for (size_t i = 0; i < MINHASH_SIZE; i += 8)
+    {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(a + i)),
+                                        _mm256_loadu_si256((const __m256i *)(b + i)));
+        cnt += (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+    }
+    return cnt;
+}
+
+#endif
+
+// === 运行时分发 ===
+
+typedef void (*MergeFn)(uint32_t *dst, const uint32_t *src);
+typedef size_t (*CountFn)(const uint32_t *a, const uint32_t *b);
+
+static MergeFn merge_min_impl = merge_min_scalar;
+static CountFn count_equal_impl = count_equal_scalar;
+
+#if CCD_SIMD_X86
+__attribute__((constructor)) static void select_minhash_kernels(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        merge_min_impl = merge_min_avx2;
+        count_equal_impl = count_equal_avx2;
+        return;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+        merge_min_impl = merge_min_sse41;
+    if (__builtin_cpu_supports("sse2"))
+        count_equal_impl = count_equal_sse2;
+}
+#endif
+
+// === 签名 ===
+
+void minhash_init(MinHash *mh) { memset(mh->v, 0xFF, sizeof(mh->v)); }
+
+void minhash_add(MinHash *mh, const NGram *grams, size_t count)
+{
+    uint32_t lanes[MINHASH_LANES][MINHASH_SIZE];
+    memset(lanes, 0xFF, sizeof(lanes));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t h = grams[i].hash;
+        uint32_t bin = (uint32_t)(h >> (64 - MINHASH_BITS));
+        uint32_t val = (uint32_t)h;
+        // MINHASH_EMPTY 留给空桶
+        val -= (val == MINHASH_EMPTY);
+
+        // 无分支取最小值：桶内最小值更新与否难以预测
+        uint32_t *slot = &lanes[i % MINHASH_LANES][bin];
+        *slot = val < *slot ? val : *slot;
+    }
+
+    for (size_t l = 0; l < MINHASH_LANES; ++l)
+        merge_min_impl(mh->v, lanes[l]);
+}
+
+// 空桶 bin 第 attempt 次尝试借用的桶，只与两者有关
+static uint32_t borrow_bin(uint32_t bin, uint32_t attempt)
+{
+    uint64_t x = ((uint64_t)bin << 32 | attempt) + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return (uint32_t)(x >> (64 - MINHASH_BITS));
+}
+
+void minhash_finish(MinHash *mh)
+{
+    // 只能从原本非空的桶借值，先记下哪些桶原本非空
+    uint64_t filled[MINHASH_SIZE / 64] = {0};
+    size_t nfilled = 0;
+    for (uint32_t i = 0; i < MINHASH_SIZE; ++i)
+        if (mh->v[i] != MINHASH_EMPTY)
+        {
+            filled[i / 64] |= 1ull << (i % 64);
+            nfilled++;
+        }
+    if (nfilled == 0 || nfilled == MINHASH_SIZE)
+        return;
+
+    for (uint32_t i = 0; i < MINHASH_SIZE; ++i)
+    {
+        if (filled[i / 64] >> (i % 64) & 1)
+            continue;
+
+        uint32_t attempt = 0, j;
+        do
+            j = borrow_bin(i, attempt++);
+        while (!(filled[j / 64] >> (j % 64) & 1));
+        mh->v[i] = mh->v[j];
+    }
+}
+
+void minhash_from_ngrams(MinHash *mh, const NGram *grams, size_t count)
+{
+    minhash_init(mh);
+    minhash_add(mh, grams, count);
+    minhash_finish(mh);
+}
+
+int minhash_is_empty(const MinHash *mh)
+{
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        if (mh->v[i] != MINHASH_EMPTY)
+            return 0;
+    return 1;
+}
+
+double minhash_similarity(const MinHash *a, const MinHash *b)
+{
+    if (minhash_is_empty(a) || minhash_is_empty(b))
+        return 0.0;
+    return (double)count_equal_impl(a->v, b->v) / MINHASH_SIZE;
+}
@@ -0,0 +1,57 @@
+#include "fingerprint_impl/ngram.h"
+#include "fingerprint_impl/normalize.h"
+
+// 滚动哈希的底数，奇数保证在模 2^64 下可逆
+#define NGRAM_BASE 0x100000001B3ull
+
+// 符号先打散再参与多项式，避免小整数之间的简单线性关系
+static uint64_t sym_value(uint16_t sym)
+{
+    uint64_t x = (uint64_t)sym + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// 多项式哈希的低位质量较差，输出前再混合一次
+static uint64_t finish(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 33);
+}
+
+int ngram_hashes(const NormStream *ns, size_t n, uint32_t file, Vector *out)
+{
+    if (!ns || !out || !n || out->ele_size != sizeof(NGram))
+        return 0;
+    if (ns->size < n)
+        return 1;
+
+    size_t count = ns->size - n + 1;
+    if (!vector_reserve(out, out->size + count))
+        return 0;
+
+    // top = BASE^(n-1)，即窗口最左边符号的权重
+    uint64_t top = 1;
+    for (size_t i = 1; i < n; ++i)
+        top *= NGRAM_BASE;
+
+    const uint16_t *syms = ns->syms;
+    uint64_t h = 0;
+    for (size_t i = 0; i < n; ++i)
+        h = h * NGRAM_BASE + sym_value(syms[i]);
+
+    NGram *dst = ngram_vec_data(out) + out->size;
+    dst[0] = (NGram){finish(h), file, 0};
+    for (size_t i = 1; i < count; ++i)
+    {
+        h = (h - sym_value(syms[i - 1]) * top) * NGRAM_BASE + sym_value(syms[i + n - 1]);
+        dst[i] = (NGram){finish(h), file, (uint32_t)i};
+    }
+
+    out->size += count;
+    return 1;
+}
@@ -0,0 +1,93 @@
+#include "fingerprint_impl/normalize.h"
+#include "tokenizer_impl/token_stream.h"
+#include "arena.h"
+
+#include <string.h>
+
+// 被丢弃的 Token 类型，其余类型原样作为符号
+static const uint8_t dropped[256] = {
+    [T_PREPROCESS] = 1, // 整行预处理指令
+    [T_BACKSLASH] = 1,  // 游离的续行符
+    [T_EOF] = 1,
+    [T_UNKNOWN] = 1,
+};
+
+NormStream *norm_stream_new(void)
+{
+    NormStream *ns = mem_alloc(sizeof(*ns));
+    if (!ns)
+        return NULL;
+    memset(ns, 0, sizeof(*ns));
+    ns->arena = arena_current();
+    return ns;
+}
+
+void norm_stream_free(NormStream *ns)
+{
+    if (!ns)
+        return;
+    Arena *prev = arena_use(ns->arena);
+    mem_free(ns->syms);
+    mem_free(ns->offsets);
+    mem_free(ns);
+    arena_use(prev);
+}
+
+uint16_t norm_symbol(TokenType type)
+{
+    return dropped[(uint8_t)type] ? NORM_DROP : (uint16_t)type;
+}
+
+static int norm_reserve(NormStream *ns, size_t cap)
+{
+    if (cap <= ns->capacity)
+        return 1;
+
+    // 复用 ns 时的活动 Arena 可能与创建时不同，扩容必须回到创建时的 Arena
+    Arena *prev = arena_use(ns->arena);
+    int ok = 0;
+
+    uint16_t *syms = mem_realloc(ns->syms, ns->capacity * sizeof(uint16_t), cap * sizeof(uint16_t));
+    if (syms)
+    {
+        ns->syms = syms;
+        uint32_t *offsets = mem_realloc(ns->offsets, ns->capacity * sizeof(uint32_t), cap * sizeof(uint32_t));
+        if (offsets)
+        {
+            ns->offsets = offsets;
+            ns->capacity = cap;
+            ok = 1;
+        }
+    }
+
+    arena_use(prev);
+    return ok;
+}
+
+int normalize_tokens(NormStream *ns, const TokenStream *ts)
+{
+    if (!ns || !ts)
+        return 0;
+
+    // 符号数不超过 Token 数，一次预留足够
+    ns->size = 0;
+    if (!norm_reserve(ns, ts->size ? ts->size : 1))
+        return 0;
+
+    // 无分支写法：每个 Token 都先写入，再按是否丢弃决定下标是否前进
+    const uint8_t *kinds = ts->kinds;
+    const uint32_t *offsets = ts->offsets;
+    uint16_t *out_syms = ns->syms;
+    uint32_t *out_offsets = ns->offsets;
+    size_t n = 0;
+    for (size_t i = 0; i < ts->size; ++i)
+    {
+        uint8_t k = kinds[i];
+        out_syms[n] = k;
+        out_offsets[n] = offsets[i];
+        n += !dropped[k];
+    }
+
+    ns->size = n;
+    return 1;
+}
@@ -0,0 +1,53 @@
+#include "fingerprint_impl/winnow.h"
+#include "fingerprint_impl/ngram.h"
+#include "arena.h"
+
+int winnow(const NGram *grams, size_t count, size_t w, Vector *out)
+{
+    if (!out || !w || out->ele_size != sizeof(NGram) || (count && !grams))
+        return 0;
+    if (!count)
+        return 1;
+    if (w > count)
+        w = count;
+
+    // 单调队列：窗口内的下标，对应的哈希从队首到队尾严格递增，队首即窗口最小值。
+    // 队列长度不超过 w，用容量为 w 的环形缓冲区
+    size_t *ring = mem_alloc(w * sizeof(size_t));
+    if (!ring)
+        return 0;
+    size_t head = 0, len = 0;
+    size_t last = SIZE_MAX; // 上一次选中的下标
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // 先移出窗口 [i - w + 1, i] 左侧的下标，给新元素腾出位置
+        if (len && ring[head] + w <= i)
+        {
+            head = (head + 1) % w;
+            len--;
+        }
+
+        // 队尾不小于新哈希的元素再也不会成为最小值 (相同时取右边的)
+        while (len && grams[ring[(head + len - 1) % w]].hash >= grams[i].hash)
+            len--;
+        ring[(head + len) % w] = i;
+        len++;
+
+        if (i + 1 < w)
+            continue;
+        size_t min = ring[head];
+        if (min != last)
+        {
+            if (!ngram_vec_push(out, grams[min]))
+            {
+                mem_free(ring);
+                return 0;
+            }
+            last = min;
+        }
+    }
+
+    mem_free(ring);
+    return 1;
+}
@@ -1,9 +1,17 @@
 #include "hash_map.h"
-#include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define HASH_GROUP 16         // 一次探测的控制字节数
+#define HASH_MIN_CAPACITY 16  // 最小容量，保证至少有一整组
+#define HASH_CTRL_EMPTY 0x80u // 空槽的控制字节
+
 uint32_t hash_str(const char *str)
 {
     if (!str)
@@ -17,97 +25,229 @@ uint32_t hash_str(const char *str)
     return h;
 }
 
-HashMap *make_hash_map(size_t count)
+uint32_t hash_str_n(const char *str, size_t len)
 {
-    HashMap *map = malloc(sizeof(*map));
+    if (!str)
+        return 0;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i)
+    {
+        h ^= (unsigned char)str[i];
+        h *= 16777619u;
+    }
+    return h;
+}
 
-    map->hashs = vector_new(sizeof(HashEntry *));
-    vector_resize(map->hashs, count);
-    // memset(map->hashs->data, 0, count * sizeof(HashEntry *));
+// 连续的驻留 id 直接取模分布很差，乘一个黄金分割常数打散
+static uint32_t hash_id(uint32_t id) { return id * 2654435761u; }
 
-    return map;
+// h1 决定起始位置，h2 存进控制字节
+static size_t hash_h1(uint32_t h) { return h >> 7; }
+static uint8_t hash_h2(uint32_t h) { return (uint8_t)(h & 0x7F); }
+
+// === 控制字节组的匹配 ===
+// 返回一个 16 位掩码，第 i 位表示 group[i] 满足条件
+
+#if defined(__SSE2__)
+static unsigned group_match(const uint8_t *group, uint8_t h2)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
 }
 
-void hash_map_free(HashMap *map)
+static unsigned group_empty(const uint8_t *group)
 {
-    if (!map)
-        return;
-    if (map->hashs)
+    // 只有空槽的最高位为 1，movemask 正好取出每个字节的最高位
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+}
+#else
+static unsigned group_match(const uint8_t *group, uint8_t h2)
+{
+    unsigned mask = 0;
+    for (int i = 0; i < HASH_GROUP; ++i)
+        mask |= (unsigned)(group[i] == h2) << i;
+    return mask;
+}
+
+static unsigned group_empty(const uint8_t *group)
+{
+    unsigned mask = 0;
+    for (int i = 0; i < HASH_GROUP; ++i)
+        mask |= (unsigned)(group[i] >> 7) << i;
+    return mask;
+}
+#endif
+
+static void set_ctrl(HashMap *map, size_t idx, uint8_t c)
+{
+    map->ctrl[idx] = c;
+    // 开头的 16 个字节在末尾有一份镜像，越过末尾的整组读取也能看到正确的值
+    if (idx < HASH_GROUP)
+        map->ctrl[map->capacity + idx] = c;
+}
+
+static int init_table(HashMap *map, size_t capacity)
+{
+    map->ctrl = mem_alloc(capacity + HASH_GROUP);
+    map->entries = mem_alloc(capacity * sizeof(HashEntry));
+    if (!map->ctrl || !map->entries)
+        return 0;
+    memset(map->ctrl, HASH_CTRL_EMPTY, capacity + HASH_GROUP);
+    map->capacity = capacity;
+    map->size = 0;
+    return 1;
+}
+
+// 找到 hash 对应的第一个空槽，调用者保证表中一定有空槽
+static size_t find_empty(HashMap *map, uint32_t h)
+{
+    size_t mask = map->capacity - 1;
+    size_t pos = hash_h1(h) & mask;
+    for (;;)
     {
-        for (size_t idx = 0; idx < map->hashs->size; ++idx)
-            hash_entry_free(*((HashEntry **)vector_get(map->hashs, idx)));
-        vector_free(map->hashs);
+        unsigned empty = group_empty(map->ctrl + pos);
+        if (empty)
+            return (pos + (size_t)__builtin_ctz(empty)) & mask;
+        pos = (pos + HASH_GROUP) & mask;
     }
-    free(map);
 }
 
-HashEntry *make_hash_entry(HashEntry *next, const char *key, void *val)
+static int grow(HashMap *map)
 {
-    if (!key)
-        return NULL;
+    uint8_t *old_ctrl = map->ctrl;
+    HashEntry *old_entries = map->entries;
+    size_t old_capacity = map->capacity, old_size = map->size;
 
-    HashEntry *entry = malloc(sizeof(*entry));
+    if (!init_table(map, old_capacity * 2))
+    {
+        mem_free(map->ctrl);
+        mem_free(map->entries);
+        map->ctrl = old_ctrl, map->entries = old_entries;
+        map->capacity = old_capacity, map->size = old_size;
+        return 0;
+    }
 
-    entry->key = str_clone(key);
-    entry->value = val;
-    entry->next = next;
+    // 直接使用缓存的 hash 重新放置，不必重新计算
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+        if (old_ctrl[i] & HASH_CTRL_EMPTY)
+            continue;
+        size_t idx = find_empty(map, old_entries[i].hash);
+        set_ctrl(map, idx, hash_h2(old_entries[i].hash));
+        map->entries[idx] = old_entries[i];
+    }
+    map->size = old_size;
 
-    return entry;
+    mem_free(old_ctrl);
+    mem_free(old_entries);
+    return 1;
 }
 
-void hash_entry_free(HashEntry *entry)
+HashMap *make_hash_map(size_t count)
+{
+    HashMap *map = mem_alloc(sizeof(*map));
+    if (!map)
+        return NULL;
+
+    // 保证 count 个元素放进去之后负载不超过 7/8
+    size_t capacity = HASH_MIN_CAPACITY;
+    while (capacity * 7 / 8 < count)
+        capacity *= 2;
+
+    if (!init_table(map, capacity))
+    {
+        hash_map_free(map);
+        return NULL;
+    }
+    return map;
+}
+
+void hash_map_free(HashMap *map)
 {
-    if (!entry)
+    if (!map)
         return;
-    if (entry->key)
-        free(entry->key);
-    hash_entry_free(entry->next);
-    free(entry);
+    if (map->ctrl && map->entries)
+        for (size_t i = 0; i < map->capacity; ++i)
+            if (!(map->ctrl[i] & HASH_CTRL_EMPTY) && map->entries[i].key)
+                mem_free(map->entries[i].key);
+    mem_free(map->ctrl);
+    mem_free(map->entries);
+    mem_free(map);
 }
 
-HashEntry *hash_map_find(HashMap *map, const char *key)
+// 通用的探测过程：key 为 NULL 时按 id 比较
+static HashEntry *probe(HashMap *map, uint32_t h, const char *key, uint32_t id)
 {
-    if (!map || !key || !map->hashs)
+    size_t mask = map->capacity - 1;
+    size_t pos = hash_h1(h) & mask;
+    uint8_t h2 = hash_h2(h);
+
+    for (;;)
+    {
+        const uint8_t *group = map->ctrl + pos;
+        for (unsigned m = group_match(group, h2); m; m &= m - 1)
+        {
+            HashEntry *e = &map->entries[(pos + (size_t)__builtin_ctz(m)) & mask];
+            if (e->hash != h)
+                continue;
+            if (key ? (e->key && strcmp(e->key, key) == 0) : (!e->key && e->id == id))
+                return e;
+        }
+        // 一组中出现空槽，说明 key 不可能在更后面
+        if (group_empty(group))
+            return NULL;
+        pos = (pos + HASH_GROUP) & mask;
+    }
+}
+
+static HashEntry *insert(HashMap *map, uint32_t h, const char *key, uint32_t id, void *val)
+{
+    HashEntry *e = probe(map, h, key, id);
+    if (e)
+        return e;
+
+    if ((map->size + 1) * 8 > map->capacity * 7 && !grow(map))
         return NULL;
 
-    uint32_t h = hash_str(key);
-    size_t idx = h % map->hashs->size;
+    char *key_copy = NULL;
+    if (key && !(key_copy = str_clone(key)))
+        return NULL;
 
-    return hash_entry_find(
-        *((HashEntry **)vector_get(map->hashs, idx)),
-        key);
+    size_t idx = find_empty(map, h);
+    set_ctrl(map, idx, hash_h2(h));
+    e = &map->entries[idx];
+    e->key = key_copy;
+    e->id = key ? 0 : id;
+    e->hash = h;
+    e->value = val;
+    map->size++;
+    return e;
 }
 
-HashEntry *hash_entry_find(HashEntry *entry, const char *key)
+HashEntry *hash_map_find(HashMap *map, const char *key)
 {
-    if (!entry || !key)
+    if (!map || !key)
         return NULL;
-    for (; entry; entry = entry->next)
-        if (!strcmp(key, entry->key))
-            return entry;
-    return NULL;
+    return probe(map, hash_str(key), key, 0);
 }
 
 HashEntry *hash_map_insert(HashMap *map, const char *key, void *val)
 {
-    if (!map || !key || !map->hashs)
+    if (!map || !key)
         return NULL;
+    return insert(map, hash_str(key), key, 0, val);
+}
 
-    uint32_t h = hash_str(key);
-    size_t idx = h % map->hashs->size;
+HashEntry *hash_map_find_id(HashMap *map, uint32_t id)
+{
+    if (!map || !id)
+        return NULL;
+    return probe(map, hash_id(id), NULL, id);
+}
 
-    HashEntry **entry_ptr = (HashEntry **)vector_get(map->hashs, idx);
-    if (!entry_ptr)
+HashEntry *hash_map_insert_id(HashMap *map, uint32_t id, void *val)
+{
+    if (!map || !id)
         return NULL;
-    HashEntry *entry = hash_entry_find(*entry_ptr, key);
-
-    if (entry)
-        return entry;
-
-    HashEntry *new_entry =
-        make_hash_entry(
-            *((HashEntry **)vector_get(map->hashs, idx)),
-            key, val);
-    *entry_ptr = new_entry;
-    return new_entry;
-}
\ No newline at end of file
+    return insert(map, hash_id(id), NULL, id, val);
+}
@@ -0,0 +1,163 @@
+#include "interner.h"
+#include "hash_map.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define INTERN_POOL_BLOCK (64 * 1024)
+#define INTERN_INIT_SLOTS 1024
+
+// 开放寻址的槽位，缓存完整 hash，探测时先比 hash 再比文本
+typedef struct
+{
+    uint32_t hash;
+    uint32_t id; // 0 表示空槽
+} InternSlot;
+
+typedef struct
+{
+    const char *str;
+    uint32_t len;
+} InternName;
+
+// 存放文本的内存块，写满后挂一块新的，旧块中的文本地址保持不变
+typedef struct InternPool
+{
+    struct InternPool *next;
+    size_t used;
+    size_t size;
+    char data[];
+} InternPool;
+
+static InternSlot *slots = NULL;
+static size_t slot_cap = 0; // 总是 2 的幂
+
+static InternName *names = NULL; // names[id]，names[0] 不使用
+static size_t name_count = 0;    // 已分配的最大 id
+static size_t name_cap = 0;
+
+static InternPool *pool = NULL;
+
+static const char *pool_store(const char *str, size_t len)
+{
+    if (!pool || pool->size - pool->used < len + 1)
+    {
+        size_t size = len + 1 > INTERN_POOL_BLOCK ? len + 1 : INTERN_POOL_BLOCK;
+        InternPool *block = malloc(sizeof(*block) + size);
+        if (!block)
+            return NULL;
+        block->next = pool;
+        block->used = 0;
+        block->size = size;
+        pool = block;
+    }
+
+    char *p = pool->data + pool->used;
+    memcpy(p, str, len);
+    p[len] = '\0';
+    pool->used += len + 1;
+    return p;
+}
+
+// 负载超过 1/2 时翻倍，只需按缓存的 hash 重新放置，不必重新计算
+static int grow_slots(void)
+{
+    size_t cap = slot_cap ? slot_cap * 2 : INTERN_INIT_SLOTS;
+    InternSlot *ns = calloc(cap, sizeof(*ns));
+    if (!ns)
+        return 0;
+
+    for (size_t i = 0; i < slot_cap; ++i)
+    {
+        if (!slots[i].id)
+            continue;
+        size_t j = slots[i].hash & (cap - 1);
+        while (ns[j].id)
+            j = (j + 1) & (cap - 1);
+        ns[j] = slots[i];
+    }
+
+    free(slots);
+    slots = ns, slot_cap = cap;
+    return 1;
+}
+
+// 返回文本所在的槽位，或者应当插入的空槽位
+static InternSlot *probe(const char *str, size_t len, uint32_t h)
+{
+    size_t i = h & (slot_cap - 1);
+    for (;;)
+    {
+        InternSlot *s = &slots[i];
+        if (!s->id)
+            return s;
+        if (s->hash == h && names[s->id].len == len &&
+            memcmp(names[s->id].str, str, len) == 0)
+            return s;
+        i = (i + 1) & (slot_cap - 1);
+    }
+}
+
+uint32_t intern_find(const char *str, size_t len)
+{
+    if (!str || !slot_cap)
+        return 0;
+    return probe(str, len, hash_str_n(str, len))->id;
+}
+
+uint32_t intern_id(const char *str, size_t len)
+{
+    if (!str || len > UINT32_MAX)
+        return 0;
+    if ((name_count + 1) * 2 > slot_cap && !grow_slots())
+        return 0;
+
+    uint32_t h = hash_str_n(str, len);
+    InternSlot *s = probe(str, len, h);
+    if (s->id)
+        return s->id;
+
+    if (name_count + 1 >= name_cap)
+    {
+        size_t cap = name_cap ? name_cap * 2 : INTERN_INIT_SLOTS;
+        InternName *nn = realloc(names, cap * sizeof(*nn));
+        if (!nn)
+            return 0;
+        names = nn, name_cap = cap;
+    }
+
+    const char *copy = pool_store(str, len);
+    if (!copy)
+        return 0;
+
+    uint32_t id = (uint32_t)++name_count;
+    names[id].str = copy;
+    names[id].len = (uint32_t)len;
+    s->hash = h, s->id = id;
+    return id;
+}
+
+const char *intern_name(uint32_t id, size_t *out_len)
+{
+    if (!id || id > name_count)
+        return NULL;
+    if (out_len)
+        *out_len = names[id].len;
+    return names[id].str;
+}
+
+size_t intern_count(void) { return name_count; }
+
+void intern_clear(void)
+{
+    while (pool)
+    {
+        InternPool *next = pool->next;
+        free(pool);
+        pool = next;
+    }
+    free(slots);
+    free(names);
+    slots = NULL, slot_cap = 0;
+    names = NULL, name_count = name_cap = 0;
+}
@@ -1,22 +1,38 @@
 #include <stdio.h>
 
 #include "ccd_cli.h"
+#include "arena.h"
+#include "source_file.h"
 
 int main(int argc, char **argv)
 {
     CompileOptions opt;
     parse_args(argc, argv, &opt);
 
-    Vector *tokens = load_and_tokenize(opt.input);
+    // 整个文件的源码、Token、语句单元都从同一个 Arena 分配，
+    // 处理完后一次性释放，不再逐个调用 *_free
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+
+    SourceFile *src = NULL;
+    Vector *tokens = load_and_tokenize(opt.input, &src);
 
     switch (opt.stage)
     {
     case STAGE_TOKENS:
-        dump_tokens(tokens);
+        dump_tokens(tokens, src);
+        break;
+
+    case STAGE_NORM:
+        dump_normalized(tokens, src);
+        break;
+
+    case STAGE_FP:
+        dump_fingerprints(tokens, src);
         break;
 
     case STAGE_UNITS:
-        dump_units(tokens);
+        dump_units(tokens, opt.jobs);
         break;
 
     case STAGE_AST:
@@ -28,5 +44,11 @@ int main(int argc, char **argv)
     default:
         break;
     }
+
+    // mmap 的源码不在 Arena 中，需要单独解除映射
+    source_file_close(src);
+
+    arena_use(prev);
+    arena_free(arena);
     return 0;
 }
\ No newline at end of file
@@ -2,12 +2,13 @@
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 CTypeInfo *make_unknown()
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
     cti->type = CT_UNKNOWN;
     return cti;
 }
@@ -16,7 +17,7 @@ CTypeInfo *c_type_info_copy(CTypeInfo *cti)
 {
     if (!cti)
         return cti;
-    CTypeInfo *copied_cti = calloc(1, sizeof(*cti));
+    CTypeInfo *copied_cti = mem_calloc(1, sizeof(*cti));
     return copied_cti;
 }
 
@@ -24,6 +25,9 @@ void c_type_info_free(CTypeInfo *cti)
 {
     if (!cti)
         return;
+    // Arena 模式下整棵树随 Arena 一起释放，无需递归遍历
+    if (arena_current())
+        return;
 
     switch (cti->type)
     {
@@ -62,7 +66,7 @@ void c_type_info_free(CTypeInfo *cti)
         break;
     case CT_UNKNOWN:
     default:
-        free(cti);
+        mem_free(cti);
     }
 }
 
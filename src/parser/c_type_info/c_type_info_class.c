@@ -1,11 +1,13 @@
 #include "parser_impl/c_type_info.h"
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
 #include "vector.h"
+#include "arena.h"
+#include <limits.h>
 #include <stdlib.h>
 
 CTypeInfo *make_struct_type(Vector *fields)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
     cti->type = CT_STRUCT;
 
     if (!fields)
@@ -67,7 +69,7 @@ void complete_struct_type(CTypeInfo *cti, Vector *fields)
 
 CTypeInfo *make_union_type(Vector *fields)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
     cti->type = CT_UNION;
 
     if (!fields)
@@ -125,7 +127,7 @@ void complete_union_type(CTypeInfo *cti, Vector *fields)
 
 CTypeInfo *make_enum_type(Vector *items)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
     cti->type = CT_ENUM;
 
     if (!items)
@@ -181,7 +183,7 @@ void c_struct_type_info_free(CTypeInfo *cti)
             c_field_type_info_free(*((Field **)vector_get(cti->record.fields, idx)));
         vector_free(cti->record.fields);
     }
-    free(cti);
+    mem_free(cti);
 }
 
 void c_union_type_info_free(CTypeInfo *cti)
@@ -194,7 +196,7 @@ void c_union_type_info_free(CTypeInfo *cti)
             c_field_type_info_free(*((Field **)vector_get(cti->record.fields, idx)));
         vector_free(cti->record.fields);
     }
-    free(cti);
+    mem_free(cti);
 }
 
 void c_enum_type_info_free(CTypeInfo *cti)
@@ -207,5 +209,5 @@ void c_enum_type_info_free(CTypeInfo *cti)
             c_enum_item_type_info_free(*((EnumItem **)vector_get(cti->enum_type.items, idx)));
         vector_free(cti->record.fields);
     }
-    free(cti);
+    mem_free(cti);
 }
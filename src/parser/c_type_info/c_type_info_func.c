@@ -1,12 +1,13 @@
 #include "parser_impl/c_type_info.h"
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 
 CTypeInfo *make_function_type(CTypeInfo *ret, Vector *params, int is_var)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_FUNCTION;
     cti->func.return_type = ret;
@@ -27,5 +28,5 @@ void c_function_type_info_free(CTypeInfo *cti)
             c_param_type_info_free(*((Param **)vector_get(cti->func.params, idx)));
         vector_free(cti->func.params);
     }
-    free(cti);
+    mem_free(cti);
 }
\ No newline at end of file
@@ -2,11 +2,12 @@
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Param *make_param_type(char *name, CTypeInfo *type)
 {
-    Param *param = calloc(1, sizeof(*param));
+    Param *param = mem_calloc(1, sizeof(*param));
 
     param->name = str_clone(name);
     param->type = type;
@@ -15,7 +16,7 @@ Param *make_param_type(char *name, CTypeInfo *type)
 
 Field *make_field_type(char *name, CTypeInfo *type, size_t offset)
 {
-    Field *field = calloc(1, sizeof(*field));
+    Field *field = mem_calloc(1, sizeof(*field));
 
     field->name = str_clone(name);
     field->type = type;
@@ -28,7 +29,7 @@ EnumItem *make_enum_item_type(char *name, long long val)
     if (!name)
         return NULL;
 
-    EnumItem *item = calloc(1, sizeof(*item));
+    EnumItem *item = mem_calloc(1, sizeof(*item));
 
     item->name = str_clone(name);
     item->value = val;
@@ -40,9 +41,9 @@ void c_param_type_info_free(Param *param)
     if (!param)
         return;
     if (param->name)
-        free(param->name);
+        mem_free(param->name);
     c_type_info_free(param->type);
-    free(param);
+    mem_free(param);
 }
 
 void c_field_type_info_free(Field *field)
@@ -50,9 +51,9 @@ void c_field_type_info_free(Field *field)
     if (!field)
         return;
     if (field->name)
-        free(field->name);
+        mem_free(field->name);
     c_type_info_free(field->type);
-    free(field);
+    mem_free(field);
 }
 
 void c_enum_item_type_info_free(EnumItem *item)
@@ -60,6 +61,6 @@ void c_enum_item_type_info_free(EnumItem *item)
     if (!item)
         return;
     if (item->name)
-        free(item->name);
-    free(item);
+        mem_free(item->name);
+    mem_free(item);
 }
\ No newline at end of file
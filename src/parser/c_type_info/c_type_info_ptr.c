@@ -1,10 +1,11 @@
 #include "parser_impl/c_type_info.h"
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
+#include "arena.h"
 #include <stdlib.h>
 
 CTypeInfo *make_pointer_type(CTypeInfo *base)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_POINTER;
     cti->pointer.base = base;
@@ -14,7 +15,7 @@ CTypeInfo *make_pointer_type(CTypeInfo *base)
 
 CTypeInfo *make_array_type(CTypeInfo *base, size_t len)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_ARRAY;
     cti->array.base = base;
@@ -28,7 +29,7 @@ void c_pointer_type_info_free(CTypeInfo *cti)
     if (!cti || cti->type != CT_POINTER)
         return;
     c_type_info_free(cti->pointer.base);
-    free(cti);
+    mem_free(cti);
 }
 
 void c_array_type_info_free(CTypeInfo *cti)
@@ -36,5 +37,5 @@ void c_array_type_info_free(CTypeInfo *cti)
     if (!cti || cti->type != CT_ARRAY)
         return;
     c_type_info_free(cti->array.base);
-    free(cti);
+    mem_free(cti);
 }
\ No newline at end of file
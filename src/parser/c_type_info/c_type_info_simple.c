@@ -1,10 +1,11 @@
 #include "parser_impl/c_type_info.h"
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
+#include "arena.h"
 #include <stdlib.h>
 
 CTypeInfo *make_void_type(unsigned storages)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_VOID;
     cti->storages = storages;
@@ -14,7 +15,7 @@ CTypeInfo *make_void_type(unsigned storages)
 
 CTypeInfo *make_char_type(unsigned storages, unsigned qualifiers, unsigned modifiers)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_CHAR;
     cti->storages = storages;
@@ -33,7 +34,7 @@ CTypeInfo *make_char_type(unsigned storages, unsigned qualifiers, unsigned modif
 
 CTypeInfo *make_int_type(unsigned storages, unsigned qualifiers, unsigned modifiers)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_INT;
     cti->storages = storages;
@@ -79,7 +80,7 @@ CTypeInfo *make_int_type(unsigned storages, unsigned qualifiers, unsigned modifi
 
 CTypeInfo *make_float_type(unsigned storages, unsigned qualifiers)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_FLOAT;
     cti->storages = storages;
@@ -90,7 +91,7 @@ CTypeInfo *make_float_type(unsigned storages, unsigned qualifiers)
 
 CTypeInfo *make_double_type(unsigned storages, unsigned qualifiers, unsigned modifiers)
 {
-    CTypeInfo *cti = calloc(1, sizeof(*cti));
+    CTypeInfo *cti = mem_calloc(1, sizeof(*cti));
 
     cti->type = CT_DOUBLE;
     cti->storages = storages;
@@ -111,33 +112,33 @@ void c_void_type_info_free(CTypeInfo *cti)
 {
     if (!cti || cti->type != CT_VOID)
         return;
-    free(cti);
+    mem_free(cti);
 }
 
 void c_char_type_info_free(CTypeInfo *cti)
 {
     if (!cti || cti->type != CT_CHAR)
         return;
-    free(cti);
+    mem_free(cti);
 }
 
 void c_int_type_info_free(CTypeInfo *cti)
 {
     if (!cti || cti->type != CT_INT)
         return;
-    free(cti);
+    mem_free(cti);
 }
 
 void c_float_type_info_free(CTypeInfo *cti)
 {
     if (!cti || cti->type != CT_FLOAT)
         return;
-    free(cti);
+    mem_free(cti);
 }
 
 void c_double_type_info_free(CTypeInfo *cti)
 {
     if (!cti || cti->type != CT_DOUBLE)
         return;
-    free(cti);
+    mem_free(cti);
 }
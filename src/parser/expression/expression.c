@@ -8,6 +8,7 @@
 #include "parser_impl/c_type_info.h"
 #include "parser_impl/c_type_info_impl/c_type_info_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -16,7 +17,7 @@ Expression *expression_copy(Expression *expr)
 {
     if (!expr)
         return NULL;
-    Expression *copied_expr = malloc(sizeof(*copied_expr));
+    Expression *copied_expr = mem_alloc(sizeof(*copied_expr));
     memcpy(copied_expr, expr, sizeof(*expr));
     return copied_expr;
 }
@@ -25,6 +26,9 @@ void expression_free(Expression *expr)
 {
     if (!expr)
         return;
+    // Arena 模式下整棵树随 Arena 一起释放，无需递归遍历
+    if (arena_current())
+        return;
     switch (expr->type)
     {
     case EXPR_LITERAL:
@@ -74,7 +78,7 @@ void expression_free(Expression *expr)
         break;
     case EXPR_UNKNOWN:
     default:
-        free(expr);
+        mem_free(expr);
         break;
     }
 }
@@ -2,13 +2,14 @@
 #include "parser_impl/expression_impl/expression_function_impl.h"
 #include "parser_impl/c_type_info.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Expression *make_expression_call(Expression *func, Vector *args)
 {
     if (!func)
         return NULL;
-    Expression *call = calloc(1, sizeof(*call));
+    Expression *call = mem_calloc(1, sizeof(*call));
 
     call->type_info = NULL; // 查函数表时再补全
     call->type = EXPR_CALL;
@@ -22,7 +23,7 @@ Expression *make_expression_sizeof_expr(Expression *expr)
 {
     if (!expr)
         return NULL;
-    Expression *call = calloc(1, sizeof(*call));
+    Expression *call = mem_calloc(1, sizeof(*call));
 
     call->type_info = make_int_type(CTS_NONE, CTQ_NONE, CTM_UNSIGNED);
     call->type = EXPR_SIZEOF_EXPR;
@@ -34,7 +35,7 @@ Expression *make_expression_sizeof_type(CTypeInfo *cti)
 {
     if (!cti)
         return NULL;
-    Expression *call = calloc(1, sizeof(*call));
+    Expression *call = mem_calloc(1, sizeof(*call));
 
     call->type_info = make_int_type(CTS_NONE, CTQ_NONE, CTM_UNSIGNED);
     call->type = EXPR_SIZEOF_TYPE;
@@ -55,7 +56,7 @@ void expression_call_free(Expression *expr)
             expression_free(*((Expression **)vector_get(expr->call.args, idx)));
         vector_free(expr->call.args);
     }
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_sizeof_expr_free(Expression *expr)
@@ -64,7 +65,7 @@ void expression_sizeof_expr_free(Expression *expr)
         return;
     c_type_info_free(expr->type_info);
     expression_free(expr->sizeof_expr.expr);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_sizeof_type_free(Expression *expr)
@@ -73,5 +74,5 @@ void expression_sizeof_type_free(Expression *expr)
         return;
     c_type_info_free(expr->type_info);
     c_type_info_free(expr->sizeof_type.type_info);
-    free(expr);
+    mem_free(expr);
 }
\ No newline at end of file
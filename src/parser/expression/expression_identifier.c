@@ -2,13 +2,14 @@
 #include "parser_impl/expression_impl/expression_identifier_impl.h"
 #include "parser_impl/c_type_info.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Expression *make_expression_identifier(char *name)
 {
     if (!name)
         return NULL;
-    Expression *expr = calloc(1, sizeof(*expr));
+    Expression *expr = mem_calloc(1, sizeof(*expr));
 
     expr->type_info = NULL; // 等查变量表的时候才有类型
     expr->type = EXPR_IDENTIFIER;
@@ -21,7 +22,7 @@ Expression *make_expression_cast(CTypeInfo *cti, Expression *expr)
 {
     if (!expr || !cti)
         return NULL;
-    Expression *cast = calloc(1, sizeof(*cast));
+    Expression *cast = mem_calloc(1, sizeof(*cast));
 
     cast->type_info = cti;
     cast->type = EXPR_CAST;
@@ -35,7 +36,7 @@ Expression *make_expression_assign(AssignOperator op, Expression *lhs, Expressio
 {
     if (!lhs || !rhs)
         return NULL;
-    Expression *assign = calloc(1, sizeof(*assign));
+    Expression *assign = mem_calloc(1, sizeof(*assign));
 
     assign->type_info = c_type_info_copy(lhs->type_info);
     assign->type = EXPR_ASSIGN;
@@ -52,8 +53,8 @@ void expression_identifier_free(Expression *expr)
         return;
     c_type_info_free(expr->type_info);
     if (expr->ident.name)
-        free(expr->ident.name);
-    free(expr);
+        mem_free(expr->ident.name);
+    mem_free(expr);
 }
 
 void expression_cast_free(Expression *expr)
@@ -63,7 +64,7 @@ void expression_cast_free(Expression *expr)
     c_type_info_free(expr->type_info);
     c_type_info_free(expr->cast.type_info);
     expression_free(expr->cast.expr);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_assign_free(Expression *expr)
@@ -73,5 +74,5 @@ void expression_assign_free(Expression *expr)
     c_type_info_free(expr->type_info);
     expression_free(expr->assign.lhs);
     expression_free(expr->assign.rhs);
-    free(expr);
+    mem_free(expr);
 }
\ No newline at end of file
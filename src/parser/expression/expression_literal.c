@@ -2,6 +2,7 @@
 #include "parser_impl/expression_impl/expression_literal_impl.h"
 #include "parser_impl/c_type_info.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Expression *make_expression_literal(CTypeInfo *cti, void *data)
@@ -9,7 +10,7 @@ Expression *make_expression_literal(CTypeInfo *cti, void *data)
     if (!cti)
         return NULL;
 
-    Expression *expr = calloc(1, sizeof(*expr));
+    Expression *expr = mem_calloc(1, sizeof(*expr));
 
     expr->type_info = cti;
     expr->type = EXPR_LITERAL;
@@ -65,7 +66,7 @@ Expression *make_expression_literal(CTypeInfo *cti, void *data)
         build_string_literal(expr, (char *)data);
         break;
     default:
-        free(expr);
+        mem_free(expr);
         return NULL;
     }
 
@@ -179,7 +180,7 @@ void expression_literal_free(Expression *expr)
     {
     case CT_UNKNOWN: // 字符串
         if (expr->literal.data.string_v)
-            free(expr->literal.data.string_v);
+            mem_free(expr->literal.data.string_v);
     case CT_CHAR:
     case CT_INT:
     case CT_FLOAT:
@@ -187,5 +188,5 @@ void expression_literal_free(Expression *expr)
     default:
         break;
     }
-    free(expr);
+    mem_free(expr);
 }
\ No newline at end of file
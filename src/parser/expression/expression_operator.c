@@ -1,6 +1,7 @@
 #include "parser_impl/expression.h"
 #include "parser_impl/expression_impl/expression_operator_impl.h"
 #include "parser_impl/c_type_info.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -8,7 +9,7 @@ Expression *make_expression_unary(UnaryOperator op, Expression *expr, int is_pre
 {
     if (!expr)
         return NULL;
-    Expression *unary = calloc(1, sizeof(*unary));
+    Expression *unary = mem_calloc(1, sizeof(*unary));
 
     if (op == OP_NOT)
         unary->type_info = make_char_type(CTS_NONE, CTQ_NONE, CTM_SIGNED);
@@ -26,7 +27,7 @@ Expression *make_expression_binary(BinaryOperator op, Expression *lhs, Expressio
 {
     if (!lhs || !rhs)
         return NULL;
-    Expression *binary = calloc(1, sizeof(*binary));
+    Expression *binary = mem_calloc(1, sizeof(*binary));
 
     binary->type_info = c_type_info_copy(lhs->type_info);
     binary->type = EXPR_BINARY;
@@ -43,7 +44,7 @@ void expression_unary_free(Expression *expr)
         return;
     c_type_info_free(expr->type_info);
     expression_free(expr->unary.expr);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_binary_free(Expression *expr)
@@ -53,5 +54,5 @@ void expression_binary_free(Expression *expr)
     c_type_info_free(expr->type_info);
     expression_free(expr->binary.lhs);
     expression_free(expr->binary.rhs);
-    free(expr);
+    mem_free(expr);
 }
\ No newline at end of file
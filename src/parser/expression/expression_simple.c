@@ -2,13 +2,14 @@
 #include "parser_impl/expression_impl/expression_simple_impl.h"
 #include "parser_impl/c_type_info.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 Expression *make_expression_subscript(Expression *base, Expression *index)
 {
     if (!base || !index)
         return NULL;
-    Expression *val = calloc(1, sizeof(*val));
+    Expression *val = mem_calloc(1, sizeof(*val));
 
     if (base->type_info)
         val->type_info = c_type_info_copy(base->type_info->array.base);
@@ -25,7 +26,7 @@ Expression *make_expression_member(Expression *base, Expression *mem)
 {
     if (!base || !mem)
         return NULL;
-    Expression *val = calloc(1, sizeof(*val));
+    Expression *val = mem_calloc(1, sizeof(*val));
 
     val->type_info = NULL; // 需要查成员表
     val->type = EXPR_MEMBER;
@@ -39,7 +40,7 @@ Expression *make_expression_ptr_member(Expression *base, Expression *mem)
 {
     if (!base || !mem)
         return NULL;
-    Expression *val = calloc(1, sizeof(*val));
+    Expression *val = mem_calloc(1, sizeof(*val));
 
     val->type_info = NULL; // 需要查成员表
     val->type = EXPR_MEMBER;
@@ -53,7 +54,7 @@ Expression *make_expression_conditional(Expression *cond, Expression *then_expr,
 {
     if (!cond || !then_expr || !else_expr)
         return NULL;
-    Expression *conditional = calloc(1, sizeof(*conditional));
+    Expression *conditional = mem_calloc(1, sizeof(*conditional));
 
     conditional->type_info = c_type_info_copy(then_expr->type_info);
     conditional->type = EXPR_CONDITIONAL;
@@ -68,7 +69,7 @@ Expression *make_expression_comma(Vector *exprs)
 {
     if (!exprs || exprs->size == 0)
         return NULL;
-    Expression *comma = calloc(1, sizeof(*comma));
+    Expression *comma = mem_calloc(1, sizeof(*comma));
 
     comma->type_info = c_type_info_copy((*((Expression **)vector_back(exprs)))->type_info);
     comma->type = EXPR_COMMA;
@@ -81,7 +82,7 @@ Expression *make_expression_paren(Expression *expr)
 {
     if (!expr)
         return NULL;
-    Expression *paren = calloc(1, sizeof(*paren));
+    Expression *paren = mem_calloc(1, sizeof(*paren));
 
     paren->type_info = c_type_info_copy(expr->type_info);
     paren->type = EXPR_PAREN;
@@ -97,7 +98,7 @@ void expression_subscript_free(Expression *expr)
     c_type_info_free(expr->type_info);
     expression_free(expr->subscript.base);
     expression_free(expr->subscript.index);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_member_free(Expression *expr)
@@ -107,7 +108,7 @@ void expression_member_free(Expression *expr)
     c_type_info_free(expr->type_info);
     expression_free(expr->member.base);
     expression_free(expr->member.mem);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_ptr_member_free(Expression *expr)
@@ -117,7 +118,7 @@ void expression_ptr_member_free(Expression *expr)
     c_type_info_free(expr->type_info);
     expression_free(expr->member.base);
     expression_free(expr->member.mem);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_conditional_free(Expression *expr)
@@ -128,7 +129,7 @@ void expression_conditional_free(Expression *expr)
     expression_free(expr->conditional.cond);
     expression_free(expr->conditional.then_expr);
     expression_free(expr->conditional.else_expr);
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_comma_free(Expression *expr)
@@ -142,7 +143,7 @@ void expression_comma_free(Expression *expr)
             expression_free(*((Expression **)vector_get(expr->comma.exprs, idx)));
         vector_free(expr->comma.exprs);
     }
-    free(expr);
+    mem_free(expr);
 }
 
 void expression_paren_free(Expression *expr)
@@ -151,5 +152,5 @@ void expression_paren_free(Expression *expr)
         return;
     c_type_info_free(expr->type_info);
     expression_free(expr->paren.expr);
-    free(expr);
+    mem_free(expr);
 }
\ No newline at end of file
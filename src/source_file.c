@@ -0,0 +1,124 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "source_file.h"
+#include "arena.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SOURCE_READ_CHUNK (64 * 1024)
+
+// 退路：从无法 mmap 的描述符 (管道、终端等) 中逐块读取全部内容
+static int read_all(int fd, SourceFile *sf)
+{
+    size_t cap = SOURCE_READ_CHUNK, len = 0;
+    char *buf = mem_alloc(cap);
+    if (!buf)
+        return -1;
+
+    for (;;)
+    {
+        if (len == cap)
+        {
+            char *nbuf = mem_realloc(buf, cap, cap * 2);
+            if (!nbuf)
+            {
+                mem_free(buf);
+                return -1;
+            }
+            buf = nbuf, cap *= 2;
+        }
+
+        ssize_t n = read(fd, buf + len, cap - len);
+        if (n < 0 && errno == EINTR) // 被信号打断，不是读取错误
+            continue;
+        if (n < 0)
+        {
+            mem_free(buf);
+            return -1;
+        }
+        if (n == 0)
+            break;
+        len += (size_t)n;
+    }
+
+    // 空输入统一用静态空串表示，source_file_close 据 len 判断是否需要释放
+    if (!len)
+    {
+        mem_free(buf);
+        buf = "";
+    }
+    sf->data = buf, sf->len = len, sf->mapped = 0;
+    return 0;
+}
+
+SourceFile *source_file_open(const char *path)
+{
+    if (!path)
+        return NULL;
+
+    int is_stdin = strcmp(path, "-") == 0;
+    int fd = is_stdin ? STDIN_FILENO : open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    SourceFile *sf = mem_alloc(sizeof(*sf));
+    if (!sf)
+    {
+        if (!is_stdin)
+            close(fd);
+        return NULL;
+    }
+
+    // 普通文件优先尝试 mmap，空文件无法映射，直接给一个空缓冲区
+    struct stat st;
+    int ok = -1;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+    {
+        if (st.st_size == 0)
+        {
+            sf->data = "", sf->len = 0, sf->mapped = 0;
+            ok = 0;
+        }
+        else
+        {
+            void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED)
+            {
+                sf->data = p, sf->len = (size_t)st.st_size, sf->mapped = 1;
+                ok = 0;
+            }
+        }
+    }
+    if (ok != 0)
+        ok = read_all(fd, sf);
+
+    // 映射建立后即可关闭描述符，不影响已映射的内存
+    if (!is_stdin)
+        close(fd);
+
+    if (ok != 0)
+    {
+        mem_free(sf);
+        return NULL;
+    }
+    return sf;
+}
+
+void source_file_close(SourceFile *sf)
+{
+    if (!sf)
+        return;
+
+    // mmap 的区域不属于 Arena，无论何种模式都必须显式解除映射
+    if (sf->mapped)
+        munmap((void *)sf->data, sf->len);
+    else if (sf->len)
+        mem_free((void *)sf->data);
+    mem_free(sf);
+}
@@ -4,6 +4,7 @@
 #include "tokenizer_impl/tokenizer_impl.h"
 #include "utils.h"
 #include "vector.h"
+#include "arena.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -12,10 +13,17 @@
 // 构造函数：初始化 Tokenizer
 Tokenizer *tokenizer_new(const char *src)
 {
-    Tokenizer *tk = malloc(sizeof(*tk));
+    // 注意：这里需要 O(N) 时间扫描长度，已知长度时应使用 tokenizer_new_n
+    return tokenizer_new_n(src, strlen(src));
+}
+
+Tokenizer *tokenizer_new_n(const char *src, size_t len)
+{
+    Tokenizer *tk = mem_alloc(sizeof(*tk));
+    if (!tk)
+        return NULL;
     tk->src = src, tk->pos = 0;
-    tk->len = strlen(src);            // 注意：这里需要 O(N) 时间扫描长度
-    tk->stus.line = tk->stus.col = 1; // 行、列号从 1 开始
+    tk->len = len;
     return tk;
 }
 
@@ -24,7 +32,7 @@ void tokenizer_free(Tokenizer *tk)
 {
     if (!tk)
         return;
-    free(tk); // 只释放结构体本身，src 是外部传入的，不归我们需要释放
+    mem_free(tk); // 只释放结构体本身，src 是外部传入的，不归我们需要释放
 }
 
 // 偷看一眼：返回当前字符，但不移动光标
@@ -34,28 +42,60 @@ char peek(Tokenizer *tk)
 }
 
 // 步进：返回当前字符，并将光标向前移动一格
-// 同时负责更新行号和列号
+// 行列号不在这里维护，'\r' 也只是普通字节
 char advance(Tokenizer *tk)
 {
-    // 如果读到了换行符，行号+1，列号重置
-    if (peek(tk) == '\n')
-        tk->stus.line++, tk->stus.col = 1;
-    else if (peek(tk) == '\r')
-    {
-        tk->pos++;
-        return advance(tk);
-    }
-    else
-        tk->stus.col++;
-
     if (tk->pos < tk->len)
         return tk->src[tk->pos++]; // 返回当前字符并 pos++
     return '\0';
 }
 
+// 字符分类表：next_into 只查一次表就能决定交给哪个子函数
+typedef enum
+{
+    CC_UNKNOWN = 0, // 无法识别的字符
+    CC_ALPHA,       // 字母或下划线 -> 关键字 / 标识符
+    CC_DIGIT,       // 数字 -> 数字字面量
+    CC_CHAR,        // ' -> 字符
+    CC_STRING,      // " -> 字符串
+    CC_PREPROCESS,  // # -> 预处理
+    CC_OPERATOR,    // 其余标点符号 -> 运算符
+} CharClass;
+
+static const unsigned char char_class[256] = {
+    ['A'] = CC_ALPHA, ['B'] = CC_ALPHA, ['C'] = CC_ALPHA, ['D'] = CC_ALPHA,
+    ['E'] = CC_ALPHA, ['F'] = CC_ALPHA, ['G'] = CC_ALPHA, ['H'] = CC_ALPHA,
+    ['I'] = CC_ALPHA, ['J'] = CC_ALPHA, ['K'] = CC_ALPHA, ['L'] = CC_ALPHA,
+    ['M'] = CC_ALPHA, ['N'] = CC_ALPHA, ['O'] = CC_ALPHA, ['P'] = CC_ALPHA,
+    ['Q'] = CC_ALPHA, ['R'] = CC_ALPHA, ['S'] = CC_ALPHA, ['T'] = CC_ALPHA,
+    ['U'] = CC_ALPHA, ['V'] = CC_ALPHA, ['W'] = CC_ALPHA, ['X'] = CC_ALPHA,
+    ['Y'] = CC_ALPHA, ['Z'] = CC_ALPHA, ['a'] = CC_ALPHA, ['b'] = CC_ALPHA,
+    ['c'] = CC_ALPHA, ['d'] = CC_ALPHA, ['e'] = CC_ALPHA, ['f'] = CC_ALPHA,
+    ['g'] = CC_ALPHA, ['h'] = CC_ALPHA, ['i'] = CC_ALPHA, ['j'] = CC_ALPHA,
+    ['k'] = CC_ALPHA, ['l'] = CC_ALPHA, ['m'] = CC_ALPHA, ['n'] = CC_ALPHA,
+    ['o'] = CC_ALPHA, ['p'] = CC_ALPHA, ['q'] = CC_ALPHA, ['r'] = CC_ALPHA,
+    ['s'] = CC_ALPHA, ['t'] = CC_ALPHA, ['u'] = CC_ALPHA, ['v'] = CC_ALPHA,
+    ['w'] = CC_ALPHA, ['x'] = CC_ALPHA, ['y'] = CC_ALPHA, ['z'] = CC_ALPHA,
+    ['_'] = CC_ALPHA,
+
+    ['0'] = CC_DIGIT, ['1'] = CC_DIGIT, ['2'] = CC_DIGIT, ['3'] = CC_DIGIT,
+    ['4'] = CC_DIGIT, ['5'] = CC_DIGIT, ['6'] = CC_DIGIT, ['7'] = CC_DIGIT,
+    ['8'] = CC_DIGIT, ['9'] = CC_DIGIT,
+
+    ['\''] = CC_CHAR, ['\"'] = CC_STRING, ['#'] = CC_PREPROCESS,
+
+    ['<'] = CC_OPERATOR, ['>'] = CC_OPERATOR, ['='] = CC_OPERATOR, ['('] = CC_OPERATOR,
+    [')'] = CC_OPERATOR, ['['] = CC_OPERATOR, [']'] = CC_OPERATOR, ['{'] = CC_OPERATOR,
+    ['}'] = CC_OPERATOR, ['!'] = CC_OPERATOR, ['&'] = CC_OPERATOR, ['|'] = CC_OPERATOR,
+    ['^'] = CC_OPERATOR, ['~'] = CC_OPERATOR, ['+'] = CC_OPERATOR, ['-'] = CC_OPERATOR,
+    ['*'] = CC_OPERATOR, ['/'] = CC_OPERATOR, ['%'] = CC_OPERATOR, ['\\'] = CC_OPERATOR,
+    ['?'] = CC_OPERATOR, [','] = CC_OPERATOR, ['.'] = CC_OPERATOR, [':'] = CC_OPERATOR,
+    [';'] = CC_OPERATOR,
+};
+
 // === 核心调度逻辑 ===
 // 这是词法分析器的主循环入口
-Token *next(Tokenizer *tk)
+void next_into(Tokenizer *tk, Token *out)
 {
     // 1. 跳过无意义的字符（空格、换行、制表符、注释等）
     skip_space(tk);
@@ -63,79 +103,87 @@ Token *next(Tokenizer *tk)
     // 2. 检查是否结束
     char ch = peek(tk);
     if (ch == '\0')
-        return tokenize_eof(tk);
+    {
+        tokenize_eof(tk, out);
+        return;
+    }
 
     // 3. 状态机分发 (Dispatcher)
-    // 根据首字符的特征，决定调用哪个子函数
-
-    // 情况 A: 是字母或下划线 -> 可能是关键字，也可能是标识符
-    if (is_alpha(ch))
-        return tokenize_keyword(tk);
-
-    // 情况 B: 是数字 -> 解析数字字面量
-    if (is_digit(ch))
-        return tokenize_number(tk);
-
-    // 情况 C: 符号处理
-    switch (ch)
+    // 根据首字符所属的字符类，决定调用哪个子函数
+    switch (char_class[(unsigned char)ch])
     {
-    case '\'': // 单引号 -> 字符
-        return tokenize_char(tk);
-    case '\"': // 双引号 -> 字符串
-        return tokenize_string(tk);
-    case '#': // 井号 -> 预处理
-        return tokenize_preprocessor(tk);
-    // 其余所有标点符号，统一交给 operator 处理
-    // 那里会有更复杂的贪婪匹配逻辑 (比如区分 + 和 ++)
-    case '<':
-    case '>':
-    case '=':
-    case '(':
-    case ')':
-    case '[':
-    case ']':
-    case '{':
-    case '}':
-    case '!':
-    case '&':
-    case '|':
-    case '^':
-    case '~':
-    case '+':
-    case '-':
-    case '*':
-    case '/':
-    case '%':
-    case '\\':
-    case '?':
-    case ',':
-    case '.':
-    case ':':
-    case ';':
-        return tokenize_operator(tk);
+    case CC_ALPHA: // 可能是关键字，也可能是标识符
+        tokenize_keyword(tk, out);
+        break;
+    case CC_DIGIT: // 解析数字字面量
+        tokenize_number(tk, out);
+        break;
+    case CC_CHAR: // 单引号 -> 字符
+        tokenize_char(tk, out);
+        break;
+    case CC_STRING: // 双引号 -> 字符串
+        tokenize_string(tk, out);
+        break;
+    case CC_PREPROCESS: // 井号 -> 预处理
+        tokenize_preprocessor(tk, out);
+        break;
+    case CC_OPERATOR:
+        // 其余所有标点符号，统一交给 operator 处理
+        // 那里会有更复杂的贪婪匹配逻辑 (比如区分 + 和 ++)
+        tokenize_operator(tk, out);
+        break;
     default:
-        return tokenize_unknown(tk);
+        tokenize_unknown(tk, out);
+        break;
     }
 }
 
+Token *next(Tokenizer *tk)
+{
+    Token *t = mem_alloc(sizeof(*t));
+    next_into(tk, t);
+    return t;
+}
+
 Vector *tokenize_all(const char *src)
 {
-    Tokenizer *tk = tokenizer_new(src);
+    return tokenize_all_n(src, strlen(src));
+}
+
+Vector *tokenize_all_n(const char *src, size_t len)
+{
+    Tokenizer *tk = tokenizer_new_n(src, len);
     if (!tk)
         return NULL;
 
     Vector *tokens = vector_new(sizeof(Token));
     if (!tokens)
+    {
+        tokenizer_free(tk);
         return NULL;
+    }
+
+    // 粗略估计：C 源码平均每 5 个字节左右产生一个 Token，
+    // 提前预留好空间，之后最多只需要少数几次翻倍扩容
+    vector_reserve_exact(tokens, tk->len / 5 + 16);
 
     for (;;)
     {
-        Token *t = next(tk);
-        vector_push_back(tokens, t);
+        // 直接在 Vector 的槽位上构造 Token，不产生中间拷贝
+        Token *t = vector_emplace_back(tokens);
+        if (!t)
+        {
+            vector_free(tokens);
+            tokenizer_free(tk);
+            return NULL;
+        }
+        next_into(tk, t);
         if (t->type == T_EOF)
             break;
     }
 
+    // Token 数组在整个编译过程中一直存在，归还估计多出的部分
+    vector_shrink_to_fit(tokens);
     tokenizer_free(tk);
     return tokens;
 }
\ No newline at end of file
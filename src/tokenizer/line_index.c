@@ -0,0 +1,57 @@
+#include "tokenizer_impl/line_index.h"
+#include "tokenizer_impl/tokenizer_impl.h"
+#include "arena.h"
+
+#include <string.h>
+
+LineIndex *line_index_new(const char *src, size_t len)
+{
+    LineIndex *li = mem_alloc(sizeof(*li));
+    if (!li)
+        return NULL;
+
+    // 先用 SIMD 内核数出行数，一次分配到位
+    li->count = count_newlines(src, len) + 1;
+    li->starts = mem_alloc(li->count * sizeof(size_t));
+    if (!li->starts)
+    {
+        mem_free(li);
+        return NULL;
+    }
+
+    // 再用 memchr 逐个跳到换行符，记录下一行的起点
+    size_t n = 0;
+    li->starts[n++] = 0;
+    const char *p = src, *end = src + len;
+    while ((p = memchr(p, '\n', end - p)) != NULL)
+        li->starts[n++] = (size_t)(++p - src);
+
+    return li;
+}
+
+void line_index_free(LineIndex *li)
+{
+    if (!li)
+        return;
+    mem_free(li->starts);
+    mem_free(li);
+}
+
+void line_index_locate(const LineIndex *li, size_t offset, size_t *line, size_t *col)
+{
+    // 二分查找最后一个 starts[i] <= offset 的行
+    size_t lo = 0, hi = li->count;
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (li->starts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    if (line)
+        *line = lo + 1;
+    if (col)
+        *col = offset - li->starts[lo] + 1;
+}
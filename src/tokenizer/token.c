@@ -1,6 +1,8 @@
 #include "tokenizer_impl/token.h"
+#include "tokenizer_impl/line_index.h"
 #include "tokenizer.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -202,33 +204,41 @@ const char *token_name(TokenType tt)
     }
 }
 
-void print_token(const Token *t)
+void print_token(const Token *t, const LineIndex *li)
 {
     // 格式化输出：
-    // 行:列  [类型名称]  "原始内容"
-    printf(
-        "%s (%.*s) at %d:%d\n",
-        token_name(t->type),
-        (int)strlen(t->str), t->str,
-        t->line, t->col);
+    // [类型名称] (原始内容) at 行:列
+    printf("%s (%.*s) at ", token_name(t->type),
+           (int)t->len, t->str ? t->str : "");
+
+    if (li)
+    {
+        size_t line, col;
+        line_index_locate(li, t->pos, &line, &col);
+        printf("%zu:%zu\n", line, col);
+    }
+    else
+        printf("+%zu\n", t->pos);
 }
 
-Token *make_token(Tokenizer *tk, TokenType tt, const char *lit, size_t len)
+void build_token(Token *t, Tokenizer *tk, TokenType tt, const char *lit, size_t len)
 {
-    Token *t = malloc(sizeof(*t));
+    if (!t)
+        return;
 
     t->type = tt;
-    if (len)
-        t->str = str_n_clone(lit, len);
-    else
-        t->str = NULL;
+    t->id = 0;
+    // 只记录源码中的位置，不拷贝字符串
+    t->str = lit;
+    t->len = lit ? len : 0;
 
-    if (tk)
-    {
-        t->line = tk->stus.line;
-        t->col = tk->stus.col;
-    }
+    t->pos = tk ? tk->pos : 0;
+}
 
+Token *make_token(Tokenizer *tk, TokenType tt, const char *lit, size_t len)
+{
+    Token *t = mem_alloc(sizeof(*t));
+    build_token(t, tk, tt, lit, len);
     return t;
 }
 
@@ -236,7 +246,5 @@ void token_free(Token *t)
 {
     if (!t)
         return;
-    if (t->str)
-        free(t->str);
-    free(t);
+    mem_free(t); // str 指向源码缓冲区，不归 Token 所有
 }
\ No newline at end of file
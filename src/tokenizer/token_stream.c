@@ -0,0 +1,156 @@
+#include "tokenizer_impl/token_stream.h"
+#include "vector.h"
+#include "arena.h"
+
+_Static_assert(T_UNKNOWN <= UINT8_MAX, "TokenType must fit in a uint8_t");
+
+#define NO_MATCH UINT32_MAX
+
+// 括号所属的类别，不是括号时返回 -1；is_open 输出是否为左括号
+static int bracket_family(TokenType type, int *is_open)
+{
+    switch (type)
+    {
+    case T_LEFT_PAREN:
+    case T_RIGHT_PAREN:
+        *is_open = type == T_LEFT_PAREN;
+        return 0;
+    case T_LEFT_BRACKET:
+    case T_RIGHT_BRACKET:
+        *is_open = type == T_LEFT_BRACKET;
+        return 1;
+    case T_LEFT_BRACE:
+    case T_RIGHT_BRACE:
+        *is_open = type == T_LEFT_BRACE;
+        return 2;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * 一遍扫描完成括号配对。
+ * 每类括号维护一个栈，栈用 match 本身串成链表：
+ * 尚未闭合的左括号的 match 暂存同类上一个未闭合左括号的下标，
+ * 因此不需要额外的栈空间。
+ */
+static void build_match(TokenStream *ts)
+{
+    uint32_t top[3] = {NO_MATCH, NO_MATCH, NO_MATCH};
+    size_t n = ts->size;
+    uint32_t end = (uint32_t)((n && ts->kinds[n - 1] == T_EOF) ? n - 1 : n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        int is_open;
+        int f = bracket_family((TokenType)ts->kinds[i], &is_open);
+        if (f < 0)
+            ts->match[i] = (uint32_t)i;
+        else if (is_open)
+        {
+            ts->match[i] = top[f];
+            top[f] = (uint32_t)i;
+        }
+        else if (top[f] == NO_MATCH)
+            ts->match[i] = (uint32_t)i;
+        else
+        {
+            uint32_t open = top[f];
+            top[f] = ts->match[open];
+            ts->match[open] = (uint32_t)i;
+            ts->match[i] = open;
+        }
+    }
+
+    // 剩下的都是没有闭合的左括号
+    for (int f = 0; f < 3; ++f)
+        while (top[f] != NO_MATCH)
+        {
+            uint32_t open = top[f];
+            top[f] = ts->match[open];
+            ts->match[open] = end;
+        }
+}
+
+TokenStream *token_stream_new(const Vector *tokens)
+{
+    // 下标和偏移都以 32 位保存，UINT32_MAX 还要留给 NO_MATCH
+    if (!tokens || tokens->size > UINT32_MAX)
+        return NULL;
+
+    TokenStream *ts = mem_alloc(sizeof(*ts));
+    if (!ts)
+        return NULL;
+
+    size_t n = tokens->size;
+    ts->src = NULL;
+    ts->size = n;
+    ts->kinds = mem_alloc(n ? n : 1);
+    ts->offsets = mem_alloc((n ? n : 1) * sizeof(uint32_t));
+    ts->lens = mem_alloc((n ? n : 1) * sizeof(uint32_t));
+    ts->ids = mem_alloc((n ? n : 1) * sizeof(uint32_t));
+    ts->match = mem_alloc((n ? n : 1) * sizeof(uint32_t));
+    if (!ts->kinds || !ts->offsets || !ts->lens || !ts->ids || !ts->match)
+    {
+        token_stream_free(ts);
+        return NULL;
+    }
+
+    const Token *arr = (const Token *)tokens->data;
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (arr[i].pos > UINT32_MAX || arr[i].len > UINT32_MAX - arr[i].pos)
+        {
+            token_stream_free(ts);
+            return NULL;
+        }
+
+        ts->kinds[i] = (uint8_t)arr[i].type;
+        ts->offsets[i] = (uint32_t)arr[i].pos;
+        ts->lens[i] = (uint32_t)arr[i].len;
+        ts->ids[i] = arr[i].id;
+
+        // Token 的 str 就是 src + pos，任取一个有文本的 Token 即可反推出 src
+        if (!ts->src && arr[i].str)
+            ts->src = arr[i].str - arr[i].pos;
+    }
+    build_match(ts);
+
+    return ts;
+}
+
+void token_stream_free(TokenStream *ts)
+{
+    if (!ts)
+        return;
+    mem_free(ts->kinds);
+    mem_free(ts->offsets);
+    mem_free(ts->lens);
+    mem_free(ts->ids);
+    mem_free(ts->match);
+    mem_free(ts);
+}
+
+TokenType token_stream_kind(const TokenStream *ts, size_t i)
+{
+    return i < ts->size ? (TokenType)ts->kinds[i] : T_EOF;
+}
+
+size_t token_stream_match(const TokenStream *ts, size_t i)
+{
+    return i < ts->size ? ts->match[i] : i;
+}
+
+int token_stream_get(const TokenStream *ts, size_t i, Token *out)
+{
+    if (!ts || i >= ts->size || !out)
+        return 0;
+
+    out->type = (TokenType)ts->kinds[i];
+    out->id = ts->ids[i];
+    out->pos = ts->offsets[i];
+    out->len = ts->lens[i];
+    // 与 tokenize_all 保持一致：没有文本的 Token (如 EOF) str 为 NULL
+    out->str = (ts->src && out->len) ? ts->src + out->pos : NULL;
+    return 1;
+}
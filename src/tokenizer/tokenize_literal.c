@@ -2,107 +2,158 @@
 #include "tokenizer_impl/tokenizer_impl.h"
 #include "tokenizer_impl/token.h"
 #include "utils.h"
+#include "interner.h"
 
 #include <string.h>
 
-// 关键字映射表
-typedef struct
-{
-    const char *kw;
-    TokenType type;
-} KwEntry;
-
-// 关键字查找表
-// 使用简单的线性查找（可用哈希表或 Trie 树优化）
-static const KwEntry kw_table[] = {
-
-    {"extern", T_EXTERN},
-    {"static", T_STATIC},
-    {"inline", T_INLINE},
-    {"register", T_REGISTER},
-    {"restrict", T_RESTRICT},
-    {"volatile", T_VOLATILE},
-    {"const", T_CONST},
-
-    {"auto", T_AUTO},
-    {"void", T_VOID},
-    {"signed", T_SIGNED},
-    {"unsigned", T_UNSIGNED},
-    {"char", T_CHAR},
-    {"short", T_SHORT},
-    {"int", T_INT},
-    {"long", T_LONG},
-    {"float", T_FLOAT},
-    {"double", T_DOUBLE},
-
-    {"do", T_DO},
-    {"while", T_WHILE},
-    {"for", T_FOR},
-    {"continue", T_CONTINUE},
-    {"break", T_BREAK},
-    {"if", T_IF},
-    {"else", T_ELSE},
-    {"switch", T_SWITCH},
-    {"case", T_CASE},
-    {"default", T_DEFAULT},
-    {"return", T_RETURN},
-    {"goto", T_GOTO},
-
-    {"enum", T_ENUM},
-    {"sizeof", T_SIZEOF},
-    {"struct", T_STRUCT},
-    {"typedef", T_TYPEDEF},
-    {"union", T_UNION},
-
-    {NULL, T_UNKNOWN},
-};
-
-Token *tokenize_keyword(Tokenizer *tk)
-{
-    Token *t = make_token(tk, T_UNKNOWN, 0, 1);
-    const char *const p = tk->src + tk->pos;
+// 关键字识别
+// 先按长度分桶，再按首字母分发，最后只做一次定长 memcmp，
+// 相当于一个手工展开的完美哈希：每个标识符至多比较一个候选关键字。
+#define KW(kw, tt) (memcmp(p, kw, sizeof(kw) - 1) == 0 ? (tt) : T_IDENTIFIER)
 
-    // 尝试匹配关键字
-    for (const KwEntry *e = kw_table; e->kw; e++)
+static TokenType keyword_type(const char *p, size_t len)
+{
+    switch (len)
     {
-        size_t len = strlen(e->kw);
-
-        // 1. 检查长度是否越界
-        // 2. 检查字符串是否匹配
-        if (tk->pos + len <= tk->len &&
-            strncmp(p, e->kw, len) == 0)
+    case 2:
+        switch (p[0])
+        {
+        case 'd':
+            return KW("do", T_DO);
+        case 'i':
+            return KW("if", T_IF);
+        }
+        break;
+    case 3:
+        switch (p[0])
         {
-            // 关键点：检查关键字边界
-            // 例如源代码是 "interface"，匹配 "int" 后，下一个字符是 'e' (isalnum)，
-            // 这说明它不是 "int" 关键字，而是标识符的一部分。
-            if (!is_alnum(p[len]))
+        case 'f':
+            return KW("for", T_FOR);
+        case 'i':
+            return KW("int", T_INT);
+        }
+        break;
+    case 4:
+        switch (p[0])
+        {
+        case 'a':
+            return KW("auto", T_AUTO);
+        case 'c':
+            if (p[1] == 'h')
+                return KW("char", T_CHAR);
+            return KW("case", T_CASE);
+        case 'e':
+            if (p[1] == 'l')
+                return KW("else", T_ELSE);
+            return KW("enum", T_ENUM);
+        case 'g':
+            return KW("goto", T_GOTO);
+        case 'l':
+            return KW("long", T_LONG);
+        case 'v':
+            return KW("void", T_VOID);
+        }
+        break;
+    case 5:
+        switch (p[0])
+        {
+        case 'b':
+            return KW("break", T_BREAK);
+        case 'c':
+            return KW("const", T_CONST);
+        case 'f':
+            return KW("float", T_FLOAT);
+        case 's':
+            return KW("short", T_SHORT);
+        case 'u':
+            return KW("union", T_UNION);
+        case 'w':
+            return KW("while", T_WHILE);
+        }
+        break;
+    case 6:
+        switch (p[0])
+        {
+        case 'd':
+            return KW("double", T_DOUBLE);
+        case 'e':
+            return KW("extern", T_EXTERN);
+        case 'i':
+            return KW("inline", T_INLINE);
+        case 'r':
+            return KW("return", T_RETURN);
+        case 's':
+            switch (p[1])
             {
-                t->type = e->type;
-                t->str = str_n_clone(p, len);
-
-                // 更新位置
-                tk->pos += len;
-                tk->stus.col += len;
-                return t;
+            case 'i':
+                if (p[2] == 'g')
+                    return KW("signed", T_SIGNED);
+                return KW("sizeof", T_SIZEOF);
+            case 't':
+                if (p[2] == 'a')
+                    return KW("static", T_STATIC);
+                return KW("struct", T_STRUCT);
+            case 'w':
+                return KW("switch", T_SWITCH);
             }
+            break;
         }
+        break;
+    case 7:
+        switch (p[0])
+        {
+        case 'd':
+            return KW("default", T_DEFAULT);
+        case 't':
+            return KW("typedef", T_TYPEDEF);
+        }
+        break;
+    case 8:
+        switch (p[0])
+        {
+        case 'c':
+            return KW("continue", T_CONTINUE);
+        case 'r':
+            if (p[2] == 'g')
+                return KW("register", T_REGISTER);
+            return KW("restrict", T_RESTRICT);
+        case 'u':
+            return KW("unsigned", T_UNSIGNED);
+        case 'v':
+            return KW("volatile", T_VOLATILE);
+        }
+        break;
     }
+    return T_IDENTIFIER;
+}
 
-    // 如果不是关键字，说明是普通标识符 (Identifier)
-    // 规则：消耗所有字母、数字和下划线
-    while (is_alnum(peek(tk)))
-        advance(tk);
+#undef KW
+
+void tokenize_keyword(Tokenizer *tk, Token *t)
+{
+    const char *const p = tk->src + tk->pos;
+    build_token(t, tk, T_IDENTIFIER, p, 0);
+
+    // 1. 一次性扫描完整的标识符：字母、数字和下划线
+    size_t len = 0;
+    while (tk->pos + len < tk->len && is_alnum(p[len]))
+        len++;
+
+    tk->pos += len;
 
-    t->type = T_IDENTIFIER;
-    size_t length = tk->src + tk->pos - p; // 计算长度
-    t->str = str_n_clone(p, length);
+    // 2. 再对整段文本做一次 O(1) 的关键字分类
+    // 例如 "interface" 长度为 9，根本不会和 "int" 比较
+    t->type = keyword_type(p, len);
+    t->len = len;
 
-    return t;
+    // 3. 标识符在词法分析时就完成驻留，后续阶段只比较整数 id
+    if (t->type == T_IDENTIFIER)
+        t->id = intern_id(p, len);
 }
 
-Token *tokenize_number(Tokenizer *tk)
+void tokenize_number(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_NUMBER, NULL, 0);
+    build_token(t, tk, T_NUMBER, NULL, 0);
     const char *const p = tk->src + tk->pos;
     // 1. 消耗整数部分
     while (is_digit(peek(tk)))
@@ -116,15 +167,13 @@ Token *tokenize_number(Tokenizer *tk)
             advance(tk);
     }
 
-    size_t length = tk->src + tk->pos - p;
-    t->str = str_n_clone(p, length);
-
-    return t;
+    t->str = p;
+    t->len = tk->src + tk->pos - p;
 }
 
-Token *tokenize_char(Tokenizer *tk)
+void tokenize_char(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_CHARACTER, NULL, 0);
+    build_token(t, tk, T_CHARACTER, NULL, 0);
     const char *const p = tk->src + tk->pos;
     advance(tk); // 消耗开头的 '
 
@@ -148,15 +197,13 @@ Token *tokenize_char(Tokenizer *tk)
     }
     advance(tk); // 消耗闭合的 '
 
-    size_t length = tk->src + tk->pos - p;
-    t->str = str_n_clone(p, length);
-
-    return t;
+    t->str = p;
+    t->len = tk->src + tk->pos - p;
 }
 
-Token *tokenize_string(Tokenizer *tk)
+void tokenize_string(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_STRING, NULL, 0);
+    build_token(t, tk, T_STRING, NULL, 0);
     const char *const p = tk->src + tk->pos;
 
     advance(tk); // 消耗开头的 "
@@ -181,8 +228,6 @@ Token *tokenize_string(Tokenizer *tk)
     }
     advance(tk); // 消耗闭合的 "
 
-    size_t length = tk->src + tk->pos - p;
-    t->str = str_n_clone(p, length);
-
-    return t;
+    t->str = p;
+    t->len = tk->src + tk->pos - p;
 }
\ No newline at end of file
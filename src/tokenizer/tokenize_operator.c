@@ -2,126 +2,100 @@
 #include "tokenizer_impl/token.h"
 #include "tokenizer_impl/tokenizer_impl.h"
 #include "utils.h"
-#include <string.h>
 
-// 运算符映射表
+// 运算符规则：以首字符为下标的 256 项查找表
+// 每个首字符最多对应 3 种第二字符、1 种第三字符，
+// 因此任何运算符都只需要几次单字节比较，不需要字符串函数。
 typedef struct
 {
-    const char *op; // 符号文本，如 ">>="
-    TokenType type; // 对应的枚举
-} OpEntry;
-
-// 运算符表
-// 注意：顺序在逻辑上不严格要求长字符在前，因为代码中实现了遍历寻找最长匹配的算法。
-static const OpEntry op_table[] = {
-
-    // ===== 长度 3 =====
-    {"<<=", T_LEFT_SHIFT_ASSIGN},
-    {">>=", T_RIGHT_SHIFT_ASSIGN},
-    {"...", T_ELLIPSIS},
-
-    // ===== 长度 2 =====
-    {"->", T_ARROW},
-    {"==", T_EQUAL},
-    {"!=", T_NOT_EQUAL},
-    {"<=", T_LESS_EQUAL},
-    {">=", T_GREATER_EQUAL},
-
-    {"&&", T_AND_AND},
-    {"||", T_OR_OR},
-
-    {"+=", T_PLUS_ASSIGN},
-    {"-=", T_MINUS_ASSIGN},
-    {"*=", T_MUL_ASSIGN},
-    {"/=", T_DIV_ASSIGN},
-    {"%=", T_MOD_ASSIGN},
-
-    {"&=", T_AND_ASSIGN},
-    {"|=", T_OR_ASSIGN},
-    {"^=", T_XOR_ASSIGN},
-
-    {"<<", T_LEFT_SHIFT},
-    {">>", T_RIGHT_SHIFT},
-
-    {"++", T_INC},
-    {"--", T_DEC},
-
+    unsigned char is_op; // 该字符是否能作为运算符的开头
+    TokenType one;       // 只取一个字符时的类型，如 '+'
+    char next[3];        // 可能的第二个字符，'\0' 表示没有
+    TokenType two[3];    // 与 next 对应的两字符类型，T_UNKNOWN 表示只是前缀 (如 "..")
+    char last;           // 三字符运算符的第三个字符 (第二个字符固定为 next[0])
+    TokenType three;     // 三字符运算符的类型，如 "<<="
+} OpRule;
+
+#define OP1(t1) {1, t1, {0}, {T_UNKNOWN}, 0, T_UNKNOWN}
+#define OP2(t1, c2, t2) {1, t1, {c2}, {t2}, 0, T_UNKNOWN}
+#define OP3(t1, c2a, t2a, c2b, t2b) {1, t1, {c2a, c2b}, {t2a, t2b}, 0, T_UNKNOWN}
+
+static const OpRule op_rules[256] = {
     // ===== 单字符运算符 =====
-    {"!", T_NOT},
-    {"~", T_TILDE},
-    {"&", T_AND},
-    {"|", T_OR},
-    {"^", T_XOR},
-
-    {"+", T_PLUS},
-    {"-", T_MINUS},
-    {"*", T_STAR},
-    {"/", T_DIV},
-    {"%", T_MOD},
-    {"=", T_ASSIGN},
-
-    {"<", T_LESS},
-    {">", T_GREATER},
-
-    {"#", T_PREPROCESS},
-    {"\\", T_BACKSLASH},
-
-    {"(", T_LEFT_PAREN},
-    {")", T_RIGHT_PAREN},
-    {"[", T_LEFT_BRACKET},
-    {"]", T_RIGHT_BRACKET},
-    {"{", T_LEFT_BRACE},
-    {"}", T_RIGHT_BRACE},
-
-    {",", T_COMMA},
-    {":", T_COLON},
-    {";", T_SEMICOLON},
-    {".", T_DOT},
-    {"?", T_QUESTION},
-
-    {NULL, T_UNKNOWN},
+    ['~'] = OP1(T_TILDE),
+    ['#'] = OP1(T_PREPROCESS),
+    ['\\'] = OP1(T_BACKSLASH),
+    ['('] = OP1(T_LEFT_PAREN),
+    [')'] = OP1(T_RIGHT_PAREN),
+    ['['] = OP1(T_LEFT_BRACKET),
+    [']'] = OP1(T_RIGHT_BRACKET),
+    ['{'] = OP1(T_LEFT_BRACE),
+    ['}'] = OP1(T_RIGHT_BRACE),
+    [','] = OP1(T_COMMA),
+    [':'] = OP1(T_COLON),
+    [';'] = OP1(T_SEMICOLON),
+    ['?'] = OP1(T_QUESTION),
+
+    // ===== 可以后接 '=' 的运算符 =====
+    ['!'] = OP2(T_NOT, '=', T_NOT_EQUAL),
+    ['^'] = OP2(T_XOR, '=', T_XOR_ASSIGN),
+    ['*'] = OP2(T_STAR, '=', T_MUL_ASSIGN),
+    ['/'] = OP2(T_DIV, '=', T_DIV_ASSIGN),
+    ['%'] = OP2(T_MOD, '=', T_MOD_ASSIGN),
+    ['='] = OP2(T_ASSIGN, '=', T_EQUAL),
+
+    // ===== 可以重复或后接 '=' 的运算符 =====
+    ['&'] = OP3(T_AND, '&', T_AND_AND, '=', T_AND_ASSIGN),
+    ['|'] = OP3(T_OR, '|', T_OR_OR, '=', T_OR_ASSIGN),
+    ['+'] = OP3(T_PLUS, '+', T_INC, '=', T_PLUS_ASSIGN),
+    ['-'] = {1, T_MINUS, {'-', '=', '>'}, {T_DEC, T_MINUS_ASSIGN, T_ARROW}, 0, T_UNKNOWN},
+
+    // ===== 三字符运算符 =====
+    ['<'] = {1, T_LESS, {'<', '='}, {T_LEFT_SHIFT, T_LESS_EQUAL}, '=', T_LEFT_SHIFT_ASSIGN},
+    ['>'] = {1, T_GREATER, {'>', '='}, {T_RIGHT_SHIFT, T_GREATER_EQUAL}, '=', T_RIGHT_SHIFT_ASSIGN},
+    ['.'] = {1, T_DOT, {'.'}, {T_UNKNOWN}, '.', T_ELLIPSIS},
 };
 
-Token *tokenize_operator(Tokenizer *tk)
+#undef OP1
+#undef OP2
+#undef OP3
+
+void tokenize_operator(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_UNKNOWN, NULL, 1); // 预设一个未知 Token
-    const char *const p = tk->src + tk->pos;       // 获取源码当前位置指针
+    build_token(t, tk, T_UNKNOWN, NULL, 0); // 预设一个未知 Token
+    const char *const p = tk->src + tk->pos; // 获取源码当前位置指针
+    const OpRule *rule = &op_rules[(unsigned char)p[0]];
 
-    const OpEntry *best = NULL;
-    size_t best_len = 0;
+    // 这里的逻辑主要是处理边界，正常 switch 进来的应该都能匹配
+    if (!rule->is_op)
+    {
+        advance(tk);
+        return;
+    }
 
     // === 贪婪匹配算法 (Maximal Munch) ===
     // 假设源码是 ">>= a"，如果不贪婪，可能匹配成 ">" (大于号)
-    // 我们必须找到能匹配上的、最长的那个符号。
-    for (const OpEntry *e = op_table; e->op; e++)
-    {
-        size_t len = strlen(e->op);
+    // 依次尝试三字符、两字符，都不行再退回单字符。
+    TokenType type = rule->one;
+    size_t len = 1;
 
-        // 1. 检查长度是否越界
-        // 2. 检查字符串是否匹配
-        if (tk->pos + len <= tk->len &&
-            strncmp(p, e->op, len) == 0)
-        {
-            // 如果匹配成功，且比当前记录的 best 还长，就更新
-            if (len > best_len)
-            {
-                best = e;
-                best_len = len;
-            }
-        }
+    char c1 = (tk->pos + 1 < tk->len) ? p[1] : '\0';
+    for (int i = 0; i < 3 && rule->next[i]; ++i)
+    {
+        if (c1 != rule->next[i])
+            continue;
+
+        char c2 = (tk->pos + 2 < tk->len) ? p[2] : '\0';
+        if (i == 0 && rule->last && c2 == rule->last)
+            type = rule->three, len = 3;
+        else if (rule->two[i] != T_UNKNOWN)
+            type = rule->two[i], len = 2;
+        break;
     }
 
-    if (best)
-    {
-        // 找到了最长匹配
-        t->type = best->type;
-        t->str = str_n_clone(p, best_len);
+    t->type = type;
+    t->str = p, t->len = len;
 
-        // 更新 Tokenizer 状态
-        tk->pos += best_len;
-        tk->stus.col += best_len;
-    }
-    else // 这里的逻辑主要是处理边界，正常 switch 进来的应该都能匹配
-        advance(tk);
-    return t;
-}
\ No newline at end of file
+    // 更新 Tokenizer 状态
+    tk->pos += len;
+}
@@ -0,0 +1,130 @@
+#include "tokenizer_impl/tokenizer_impl.h"
+
+#include <stddef.h>
+
+// 只有 x86 上的 GCC / Clang 才启用 SIMD 快速路径，
+// 其他平台直接使用标量实现
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CCD_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define CCD_SIMD_X86 0
+#endif
+
+// === 标量实现 (所有平台可用，也是 SIMD 版本处理尾部的兜底) ===
+
+size_t span_blank_scalar(const char *s, size_t n)
+{
+    size_t i = 0;
+    while (i < n && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r'))
+        i++;
+    return i;
+}
+
+size_t count_newlines_scalar(const char *s, size_t n)
+{
+    size_t cnt = 0;
+    for (size_t i = 0; i < n; ++i)
+        cnt += (s[i] == '\n');
+    return cnt;
+}
+
+#if CCD_SIMD_X86
+
+// === SSE2：一次比较 16 字节 ===
+
+__attribute__((target("sse2"))) static size_t span_blank_sse2(const char *s, size_t n)
+{
+    const __m128i sp = _mm_set1_epi8(' '), tab = _mm_set1_epi8('\t');
+    const __m128i lf = _mm_set1_epi8('\n'), cr = _mm_set1_epi8('\r');
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, tab)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr)));
+        unsigned mask = (unsigned)_mm_movemask_epi8(blank);
+        if (mask != 0xFFFFu)
+            return i + (size_t)__builtin_ctz(~mask); // 第一个非空白字节
+    }
+    return i + span_blank_scalar(s + i, n - i);
+}
+
+__attribute__((target("sse2"))) static size_t count_newlines_sse2(const char *s, size_t n)
+{
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    size_t cnt = 0, i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        cnt += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, lf)));
+    }
+    return cnt + count_newlines_scalar(s + i, n - i);
+}
+
+// === AVX2：一次比较 32 字节 ===
+
+__attribute__((target("avx2"))) static size_t span_blank_avx2(const char *s, size_t n)
+{
+    const __m256i sp = _mm256_set1_epi8(' '), tab = _mm256_set1_epi8('\t');
+    const __m256i lf = _mm256_set1_epi8('\n'), cr = _mm256_set1_epi8('\r');
+
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i blank = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, sp), _mm256_cmpeq_epi8(v, tab)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, lf), _mm256_cmpeq_epi8(v, cr)));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(blank);
+        if (mask != 0xFFFFFFFFu)
+            return i + (size_t)__builtin_ctz(~mask);
+    }
+    return i + span_blank_sse2(s + i, n - i);
+}
+
+__attribute__((target("avx2"))) static size_t count_newlines_avx2(const char *s, size_t n)
+{
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    size_t cnt = 0, i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        cnt += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, lf)));
+    }
+    return cnt + count_newlines_sse2(s + i, n - i);
+}
+
+#endif
+
+// === 运行时分发 ===
+// 程序启动时根据 CPU 支持的指令集选择一次实现，
+// 之后只读不写，多线程下也无需加锁。
+
+typedef size_t (*ScanFn)(const char *s, size_t n);
+
+static ScanFn span_blank_impl = span_blank_scalar;
+static ScanFn count_newlines_impl = count_newlines_scalar;
+
+#if CCD_SIMD_X86
+__attribute__((constructor)) static void select_scan_kernels(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        span_blank_impl = span_blank_avx2;
+        count_newlines_impl = count_newlines_avx2;
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        span_blank_impl = span_blank_sse2;
+        count_newlines_impl = count_newlines_sse2;
+    }
+}
+#endif
+
+size_t span_blank(const char *s, size_t n) { return span_blank_impl(s, n); }
+
+size_t count_newlines(const char *s, size_t n) { return count_newlines_impl(s, n); }
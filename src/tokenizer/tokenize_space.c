@@ -2,60 +2,67 @@
 #include "tokenizer_impl/token.h"
 #include "tokenizer_impl/tokenizer_impl.h"
 #include "utils.h"
+
 #include <stdio.h>
+#include <string.h>
 
 // 循环跳过空白符和注释，直到遇到有效代码字符
 void skip_space(Tokenizer *tk)
 {
-    while (is_space(peek(tk)) || consume_newline(tk) || peek(tk) == '/')
+    for (;;)
     {
-        while (peek(tk) == '/')
-        {
-            char ch = (tk->pos + 1) < tk->len ? tk->src[tk->pos + 1] : '\0';
-            if (ch == '/' || ch == '*')
-                skip_comment(tk); // 进入注释处理
-            else if (is_space(ch))
-                advance(tk);
-            else
-                break;
-        }
-        if (is_space(peek(tk)))
-            advance(tk);
-        else if (consume_newline(tk))
-            advance(tk);
+        size_t n = span_blank(tk->src + tk->pos, tk->len - tk->pos);
+        tk->pos += n;
+
+        // 只有 "//" 和 "/*" 才是注释，单独的 '/' 留给运算符处理
+        if (tk->pos + 1 < tk->len && tk->src[tk->pos] == '/' &&
+            (tk->src[tk->pos + 1] == '/' || tk->src[tk->pos + 1] == '*'))
+            skip_comment(tk);
+        else
+            break;
     }
 }
 
+// 调用前需保证当前位置是 "//" 或 "/*"
 void skip_comment(Tokenizer *tk)
 {
-    advance(tk); // skip /
-    if (peek(tk) == '*')
+    const char *const p = tk->src + tk->pos;
+    const char *const end = tk->src + tk->len;
+    const char *q = p + 2;
+
+    if (p[1] == '*')
     {
-        advance(tk); // skip *
-        while (peek(tk) != '\0')
+        // 块注释：用 memchr 跳到下一个 '*'，再检查后面是否紧跟 '/'
+        for (;;)
         {
-            if (peek(tk) == '*')
+            q = memchr(q, '*', end - q);
+            if (!q)
             {
-                advance(tk);
-                if (peek(tk) == '/')
-                    break;
+                q = end; // 未闭合的注释一直延续到文件末尾
+                break;
             }
-            else
-                advance(tk);
+            if (q + 1 < end && q[1] == '/')
+            {
+                q += 2;
+                break;
+            }
+            q++;
         }
     }
     else
     {
-        while (peek(tk) != '\0' && !consume_newline(tk))
-            advance(tk);
-        if (peek(tk) == '\n')
-            advance(tk);
+        // 行注释：停在换行符上，换行交给 skip_space 处理
+        q = memchr(q, '\n', end - q);
+        if (!q)
+            q = end;
     }
+
+    tk->pos += (size_t)(q - p);
 }
 
-Token *tokenize_preprocessor(Tokenizer *tk)
+void tokenize_preprocessor(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_PREPROCESS, NULL, 0);
+    build_token(t, tk, T_PREPROCESS, NULL, 0);
     const char *const p = tk->src + tk->pos;
 
     advance(tk); // 跳过 '#'
@@ -88,23 +95,17 @@ Token *tokenize_preprocessor(Tokenizer *tk)
         length--;
 
     if (length)
-        t->str = str_n_clone(p, length);
-    else
-        t->str = NULL;
-
-    return t;
+        t->str = p, t->len = length;
 }
 
-Token *tokenize_eof(Tokenizer *tk)
+void tokenize_eof(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_EOF, NULL, 1);
+    build_token(t, tk, T_EOF, NULL, 0);
     advance(tk);
-    return t;
 }
 
-Token *tokenize_unknown(Tokenizer *tk)
+void tokenize_unknown(Tokenizer *tk, Token *t)
 {
-    Token *t = make_token(tk, T_UNKNOWN, tk->src + tk->pos, 1);
+    build_token(t, tk, T_UNKNOWN, tk->src + tk->pos, 1);
     advance(tk); // 暂时这么写，之后会有贪婪匹配
-    return t;
 }
\ No newline at end of file
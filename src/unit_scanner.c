@@ -3,14 +3,31 @@
 #include "unit_scanner_impl/statement_unit.h"
 #include "tokenizer.h"
 #include "tokenizer_impl/token.h"
+#include "tokenizer_impl/token_stream.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 UnitScanner *unit_scanner_new(Vector *tokens)
 {
-    UnitScanner *us = malloc(sizeof(*us));
+    UnitScanner *us = mem_alloc(sizeof(*us));
+    if (!us)
+        return NULL;
     us->tokens = tokens;
+    us->stream = token_stream_new(tokens);
+    us->frames = frame_vec_new();
+    us->arenas = NULL;
     us->pos = 0;
+    us->end = tokens ? tokens->size : 0;
+    us->overrun = 0;
+
+    // 失败时 tokens 仍归调用者所有
+    if (!us->stream || !us->frames)
+    {
+        us->tokens = NULL;
+        unit_scanner_free(us);
+        return NULL;
+    }
     return us;
 }
 
@@ -19,59 +36,80 @@ void unit_scanner_free(UnitScanner *us)
     if (!us)
         return;
     vector_free(us->tokens);
-    free(us);
+    token_stream_free(us->stream);
+    vector_free(us->frames);
+    if (us->arenas)
+    {
+        for (size_t i = 0; i < us->arenas->size; ++i)
+            arena_free(*(Arena **)vector_get(us->arenas, i));
+        vector_free(us->arenas);
+    }
+    mem_free(us);
 }
 
 Token *peek_token(UnitScanner *us) { return (Token *)vector_get(us->tokens, us->pos); }
 Token *next_token(UnitScanner *us) { return (Token *)vector_get(us->tokens, us->pos++); }
 
+TokenType peek_kind(UnitScanner *us) { return peek_kind_at(us, 0); }
+
+TokenType peek_kind_at(UnitScanner *us, size_t ahead)
+{
+    size_t pos = us->pos + ahead;
+    if (pos >= us->end)
+    {
+        us->overrun = 1;
+        return T_EOF;
+    }
+    return token_stream_kind(us->stream, pos);
+}
+
+void skip_to_match(UnitScanner *us)
+{
+    size_t match = token_stream_match(us->stream, us->pos);
+    if (match >= us->end)
+    {
+        us->overrun = 1;
+        match = us->end;
+    }
+    us->pos = match;
+}
+
 StatementUnit *scan_file(UnitScanner *us)
 {
     if (!us)
         return NULL;
 
-    Vector *units = vector_new(sizeof(StatementUnit *));
-    while (peek_token(us)->type != T_EOF)
+    Vector *units = unit_vec_new();
+    while (peek_kind(us) != T_EOF)
     {
-        StatementUnit *ptr = scan_unit(us);
-        vector_push_back(units, &ptr);
+        size_t unit_pos = us->pos;
+        unit_vec_push(units, scan_unit(us));
+
+        // 同 scan_compound：保证扫描一定能向前推进
+        if (us->pos == unit_pos)
+            next_token(us);
     }
 
     StatementUnit *unit = make_compound_statement_unit(
-        vector_slice(us->tokens, 0, us->tokens->size),
+        token_range_all(us->tokens),
         units);
 
     return unit;
 }
 
-StatementUnit *scan_unit(UnitScanner *us)
+// 不含子语句的简单语句，一次扫描完毕
+static StatementUnit *scan_simple(UnitScanner *us)
 {
-    if (!us)
-        return NULL;
-
-    Token *t = peek_token(us);
-    switch (t->type)
+    switch (peek_kind(us))
     {
     case T_IDENTIFIER:
         return scan_identifier(us);
     case T_SEMICOLON:
         return scan_empty(us);
-    case T_LEFT_BRACE:
-        return scan_compound(us);
-    case T_IF:
-        return scan_if(us);
-    case T_SWITCH:
-        return scan_switch(us);
     case T_CASE:
         return scan_case(us);
     case T_DEFAULT:
         return scan_default(us);
-    case T_WHILE:
-        return scan_while(us);
-    case T_DO:
-        return scan_do_while(us);
-    case T_FOR:
-        return scan_for(us);
     case T_CONTINUE:
         return scan_continue(us);
     case T_BREAK:
@@ -85,30 +123,108 @@ StatementUnit *scan_unit(UnitScanner *us)
     default:
     {
         StatementUnit *unit = scan_decl_or_expression(us);
-        if (peek_token(us)->type == T_SEMICOLON)
+        if (peek_kind(us) == T_SEMICOLON)
             next_token(us);
         return unit;
     }
     }
 }
 
-StatementUnit *scan_identifier(UnitScanner *us)
+static ScanStep scan_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    switch (peek_kind(us))
+    {
+    case T_LEFT_BRACE:
+        return scan_compound_begin(us, frame, out);
+    case T_IF:
+        return scan_if_begin(us, frame, out);
+    case T_SWITCH:
+        return scan_switch_begin(us, frame, out);
+    case T_WHILE:
+        return scan_while_begin(us, frame, out);
+    case T_DO:
+        return scan_do_while_begin(us, frame, out);
+    case T_FOR:
+        return scan_for_begin(us, frame, out);
+    default:
+        *out = scan_simple(us);
+        return SCAN_DONE;
+    }
+}
+
+static ScanStep scan_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    switch (frame->type)
+    {
+    case SUT_COMPOUND:
+        return scan_compound_resume(us, frame, child, out);
+    case SUT_IF:
+        return scan_if_resume(us, frame, child, out);
+    case SUT_SWITCH:
+        return scan_switch_resume(us, frame, child, out);
+    case SUT_WHILE:
+        return scan_while_resume(us, frame, child, out);
+    case SUT_DO_WHILE:
+        return scan_do_while_resume(us, frame, child, out);
+    case SUT_FOR:
+        return scan_for_resume(us, frame, child, out);
+    default:
+        *out = child;
+        return SCAN_DONE;
+    }
+}
+
+StatementUnit *scan_unit(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_IDENTIFIER)
-        return NULL;
 
-    Token *t = (Token *)vector_get(us->tokens, us->pos + 1);
-    if (!t)
+    // 复合语句需要子语句时把自己压栈，子语句扫描完毕后再出栈继续，
+    // 因此嵌套深度只受堆内存限制，不会耗尽 C 调用栈
+    Vector *frames = us->frames;
+    size_t base = frames->size;
+
+    ScanFrame frame;
+    StatementUnit *unit = NULL;
+    ScanStep step = scan_begin(us, &frame, &unit);
+
+    while (step != SCAN_DONE || frames->size > base)
     {
-        StatementUnit *unit = scan_decl_or_expression(us);
-        if (peek_token(us)->type == T_SEMICOLON)
-            next_token(us);
-        return unit;
+        if (step != SCAN_DONE)
+        {
+            if (!frame_vec_push(frames, frame))
+            {
+                unit = NULL;
+                break;
+            }
+
+            // 同 scan_compound：子语句要求是 { ... } 却不是时结果为 NULL
+            if (step == SCAN_COMPOUND && peek_kind(us) != T_LEFT_BRACE)
+            {
+                unit = NULL;
+                step = SCAN_DONE;
+            }
+            else
+                step = scan_begin(us, &frame, &unit);
+            continue;
+        }
+
+        frame = frame_vec_pop(frames);
+        step = scan_resume(us, &frame, unit, &unit);
     }
 
-    switch (t->type)
+    frames->size = base;
+    return unit;
+}
+
+StatementUnit *scan_identifier(UnitScanner *us)
+{
+    if (!us)
+        return NULL;
+    if (peek_kind(us) != T_IDENTIFIER)
+        return NULL;
+
+    switch (peek_kind_at(us, 1))
     {
     case T_COLON:
         return scan_label(us);
@@ -162,7 +278,7 @@ StatementUnit *scan_identifier(UnitScanner *us)
     case T_IDENTIFIER:
     {
         StatementUnit *unit = scan_decl_or_expression(us);
-        if (peek_token(us)->type == T_SEMICOLON)
+        if (peek_kind(us) == T_SEMICOLON)
             next_token(us);
         return unit;
     }
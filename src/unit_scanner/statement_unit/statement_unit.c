@@ -10,6 +10,7 @@
 #include "tokenizer_impl/tokenizer_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -18,74 +19,136 @@ StatementUnit *statement_unit_copy(StatementUnit *unit)
 {
     if (!unit)
         return NULL;
-    StatementUnit *copied_unit = malloc(sizeof(*copied_unit));
+    StatementUnit *copied_unit = mem_alloc(sizeof(*copied_unit));
     memcpy(copied_unit, unit, sizeof(*unit));
     return copied_unit;
 }
 
-void statement_unit_free(StatementUnit *unit)
+// 把 unit 的直接子语句压入 stack
+static void push_children(Vector *stack, StatementUnit *unit)
 {
-    if (!unit)
-        return;
+    StatementUnit *children[4] = {NULL, NULL, NULL, NULL};
 
     switch (unit->type)
     {
     case SUT_COMPOUND:
-        statement_unit_compound_free(unit);
-        break;
-    case SUT_EMPTY:
-        statement_unit_empty_free(unit);
-        break;
-    case SUT_DECL_OR_EXPR:
-        statement_unit_decl_or_expr_free(unit);
-        break;
-        break;
+        if (unit->compound_stmt.units)
+            for (size_t idx = 0; idx < unit->compound_stmt.units->size; ++idx)
+                unit_vec_push(stack, unit_vec_at(unit->compound_stmt.units, idx));
+        return;
     case SUT_IF:
-        statement_unit_if_free(unit);
+        children[0] = unit->if_stmt.cond;
+        children[1] = unit->if_stmt.then_body;
+        children[2] = unit->if_stmt.else_body;
         break;
     case SUT_SWITCH:
-        statement_unit_switch_free(unit);
+        children[0] = unit->switch_stmt.expr;
+        children[1] = unit->switch_stmt.body;
         break;
     case SUT_CASE:
-        statement_unit_case_free(unit);
-        break;
-    case SUT_DEFAULT:
-        statement_unit_default_free(unit);
+        children[0] = unit->case_stmt.expr;
         break;
     case SUT_WHILE:
-        statement_unit_while_free(unit);
+        children[0] = unit->while_stmt.cond;
+        children[1] = unit->while_stmt.body;
         break;
     case SUT_DO_WHILE:
-        statement_unit_do_while_free(unit);
+        children[0] = unit->do_while_stmt.body;
+        children[1] = unit->do_while_stmt.cond;
         break;
     case SUT_FOR:
-        statement_unit_for_free(unit);
-        break;
-    case SUT_CONTINUE:
-        statement_unit_continue_free(unit);
-        break;
-    case SUT_BREAK:
-        statement_unit_break_free(unit);
+        children[0] = unit->for_stmt.init;
+        children[1] = unit->for_stmt.cond;
+        children[2] = unit->for_stmt.step;
+        children[3] = unit->for_stmt.body;
         break;
     case SUT_RETURN:
-        statement_unit_return_free(unit);
-        break;
-    case SUT_LABEL:
-        statement_unit_label_free(unit);
-        break;
-    case SUT_GOTO:
-        statement_unit_goto_free(unit);
+        children[0] = unit->return_stmt.expr;
         break;
     default:
-        free(unit);
+        return;
     }
+
+    for (int i = 0; i < 4; ++i)
+        if (children[i])
+            unit_vec_push(stack, children[i]);
 }
 
-void statement_unit_free_tokens(Vector *tokens)
+void statement_unit_free(StatementUnit *unit)
 {
-    if (!tokens)
+    if (!unit)
+        return;
+    // Arena 模式下整棵树随 Arena 一起释放，无需遍历
+    if (arena_current())
         return;
-    vector_free(tokens);
+
+    // 用显式栈代替递归：各 statement_unit_xxx_free 只释放节点本身，
+    // 子语句先压栈，之后再逐个释放
+    Vector *stack = unit_vec_new();
+    if (!stack)
+        return;
+    unit_vec_push(stack, unit);
+
+    while (stack->size)
+    {
+        StatementUnit *node = unit_vec_pop(stack);
+        if (!node)
+            continue;
+        push_children(stack, node);
+
+        switch (node->type)
+        {
+        case SUT_COMPOUND:
+            statement_unit_compound_free(node);
+            break;
+        case SUT_EMPTY:
+            statement_unit_empty_free(node);
+            break;
+        case SUT_DECL_OR_EXPR:
+            statement_unit_decl_or_expr_free(node);
+            break;
+        case SUT_IF:
+            statement_unit_if_free(node);
+            break;
+        case SUT_SWITCH:
+            statement_unit_switch_free(node);
+            break;
+        case SUT_CASE:
+            statement_unit_case_free(node);
+            break;
+        case SUT_DEFAULT:
+            statement_unit_default_free(node);
+            break;
+        case SUT_WHILE:
+            statement_unit_while_free(node);
+            break;
+        case SUT_DO_WHILE:
+            statement_unit_do_while_free(node);
+            break;
+        case SUT_FOR:
+            statement_unit_for_free(node);
+            break;
+        case SUT_CONTINUE:
+            statement_unit_continue_free(node);
+            break;
+        case SUT_BREAK:
+            statement_unit_break_free(node);
+            break;
+        case SUT_RETURN:
+            statement_unit_return_free(node);
+            break;
+        case SUT_LABEL:
+            statement_unit_label_free(node);
+            break;
+        case SUT_GOTO:
+            statement_unit_goto_free(node);
+            break;
+        default:
+            mem_free(node);
+        }
+    }
+
+    vector_free(stack);
 }
 
 char *statement_unit_name(StatementUnitType sut)
@@ -134,46 +197,48 @@ void print_statement_unit(StatementUnit *unit, int token_printed)
     print_statement_unit_impl(unit, 0, token_printed);
 }
 
-void print_tokens(Vector *tokens)
+void print_tokens(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
     {
         printf("<no tokens>");
         return;
     }
 
-    for (size_t i = 0; i < tokens->size; ++i)
+    for (size_t i = 0; i < token_range_size(tokens); ++i)
     {
-        Token *t = vector_get(tokens, i);
+        Token *t = token_range_get(tokens, i);
 
         // 打印: TYPE(text)
         printf("%s(", token_name(t->type));
         if (t->str)
-            printf("%.*s", (int)strlen(t->str), t->str);
+            printf("%.*s", (int)t->len, t->str);
         else
             printf("None");
         printf(") ");
     }
 }
 
-void print_statement_unit_impl(StatementUnit *unit, int indent, int token_printed)
+// 打印栈中的一项：title 不为 NULL 时只打印一行标题，否则打印 unit
+typedef struct
 {
-    if (!unit)
-        return;
+    StatementUnit *unit;
+    const char *title;
+    int indent;
+} PrintItem;
 
-    // 打印类型标题
-    print_indent(indent);
-    printf("[%s]", statement_unit_name(unit->type));
+VEC_DEFINE(print_vec, PrintItem)
 
-    if (token_printed)
-    {
-        if (unit->tokens && unit->tokens->size > 0)
-        {
-            printf("  ");
-            print_tokens(unit->tokens);
-        }
-    }
-    printf("\n");
+static void push_print(Vector *stack, StatementUnit *unit, const char *title, int indent)
+{
+    print_vec_push(stack, (PrintItem){unit, title, indent});
+}
+
+// 把 unit 的子语句按打印顺序的逆序压栈，使其出栈顺序与递归打印一致
+static void push_print_children(Vector *stack, StatementUnit *unit, int indent)
+{
+    PrintItem parts[4]; // 依次为各个子语句及其标题
+    int count = 0;
 
     switch (unit->type)
     {
@@ -181,96 +246,50 @@ void print_statement_unit_impl(StatementUnit *unit, int indent, int token_printe
     {
         Vector *items = unit->compound_stmt.units;
         if (items)
-        {
-            for (size_t i = 0; i < items->size; ++i)
-            {
-                StatementUnit *child = *((StatementUnit **)vector_get(items, i));
-                print_statement_unit_impl(child, indent + 4, token_printed);
-            }
-        }
-        break;
+            for (size_t i = items->size; i-- > 0;)
+                push_print(stack, unit_vec_at(items, i), NULL, indent + 4);
+        return;
     }
 
     case SUT_IF:
-        print_indent(indent + 2);
-        printf("Condition:\n");
-        print_statement_unit_impl(unit->if_stmt.cond, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Then:\n");
-        print_statement_unit_impl(unit->if_stmt.then_body, indent + 4, token_printed);
-
+        parts[count++] = (PrintItem){unit->if_stmt.cond, "Condition:", indent};
+        parts[count++] = (PrintItem){unit->if_stmt.then_body, "Then:", indent};
         if (unit->if_stmt.else_body)
-        {
-            print_indent(indent + 2);
-            printf("Else:\n");
-            print_statement_unit_impl(unit->if_stmt.else_body, indent + 4, token_printed);
-        }
+            parts[count++] = (PrintItem){unit->if_stmt.else_body, "Else:", indent};
         break;
 
     case SUT_SWITCH:
-        print_indent(indent + 2);
-        printf("Switch expr:\n");
-        print_statement_unit_impl(unit->switch_stmt.expr, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Body:\n");
-        print_statement_unit_impl(unit->switch_stmt.body, indent + 4, token_printed);
+        parts[count++] = (PrintItem){unit->switch_stmt.expr, "Switch expr:", indent};
+        parts[count++] = (PrintItem){unit->switch_stmt.body, "Body:", indent};
         break;
 
     case SUT_CASE:
-        print_indent(indent + 2);
-        printf("Case expr:\n");
-        print_statement_unit_impl(unit->case_stmt.expr, indent + 4, token_printed);
+        parts[count++] = (PrintItem){unit->case_stmt.expr, "Case expr:", indent};
         break;
 
     case SUT_WHILE:
-        print_indent(indent + 2);
-        printf("Condition:\n");
-        print_statement_unit_impl(unit->while_stmt.cond, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Body:\n");
-        print_statement_unit_impl(unit->while_stmt.body, indent + 4, token_printed);
+        parts[count++] = (PrintItem){unit->while_stmt.cond, "Condition:", indent};
+        parts[count++] = (PrintItem){unit->while_stmt.body, "Body:", indent};
         break;
 
     case SUT_DO_WHILE:
-        print_indent(indent + 2);
-        printf("Body:\n");
-        print_statement_unit_impl(unit->do_while_stmt.body, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Condition:\n");
-        print_statement_unit_impl(unit->do_while_stmt.cond, indent + 4, token_printed);
+        parts[count++] = (PrintItem){unit->do_while_stmt.body, "Body:", indent};
+        parts[count++] = (PrintItem){unit->do_while_stmt.cond, "Condition:", indent};
         break;
 
     case SUT_FOR:
-        print_indent(indent + 2);
-        printf("Init:\n");
-        print_statement_unit_impl(unit->for_stmt.init, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Cond:\n");
-        print_statement_unit_impl(unit->for_stmt.cond, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Step:\n");
-        print_statement_unit_impl(unit->for_stmt.step, indent + 4, token_printed);
-
-        print_indent(indent + 2);
-        printf("Body:\n");
-        print_statement_unit_impl(unit->for_stmt.body, indent + 4, token_printed);
+        parts[count++] = (PrintItem){unit->for_stmt.init, "Init:", indent};
+        parts[count++] = (PrintItem){unit->for_stmt.cond, "Cond:", indent};
+        parts[count++] = (PrintItem){unit->for_stmt.step, "Step:", indent};
+        parts[count++] = (PrintItem){unit->for_stmt.body, "Body:", indent};
         break;
 
     case SUT_RETURN:
         if (unit->return_stmt.expr)
-        {
-            print_indent(indent + 2);
-            printf("Expr:\n");
-            print_statement_unit_impl(unit->return_stmt.expr, indent + 4, token_printed);
-        }
+            parts[count++] = (PrintItem){unit->return_stmt.expr, "Expr:", indent};
         break;
 
+    // 没有子语句，附加信息直接打印
     case SUT_LABEL:
         print_indent(indent + 2);
         printf("Label name: %s\n", unit->label_stmt.name);
@@ -281,7 +300,7 @@ void print_statement_unit_impl(StatementUnit *unit, int indent, int token_printe
         printf("Goto name: %s\n", unit->goto_stmt.name);
         break;
 
-    // === 简单语句已经在顶部打印 tokens，不需要额外递归 ===
+    // === 简单语句已经在顶部打印 tokens，不需要额外处理 ===
     case SUT_PREPROCESSOR:
     case SUT_DECL_OR_EXPR:
     case SUT_BREAK:
@@ -294,4 +313,54 @@ void print_statement_unit_impl(StatementUnit *unit, int indent, int token_printe
         print_indent(indent + 2);
         printf("<unknown variant>\n");
     }
+
+    for (int i = count; i-- > 0;)
+    {
+        push_print(stack, parts[i].unit, NULL, parts[i].indent + 4);
+        push_print(stack, NULL, parts[i].title, parts[i].indent + 2);
+    }
+}
+
+void print_statement_unit_impl(StatementUnit *unit, int indent, int token_printed)
+{
+    if (!unit)
+        return;
+
+    // 用显式栈代替递归，深层嵌套不会耗尽 C 调用栈
+    Vector *stack = print_vec_new();
+    if (!stack)
+        return;
+    push_print(stack, unit, NULL, indent);
+
+    while (stack->size)
+    {
+        PrintItem item = print_vec_pop(stack);
+
+        if (item.title)
+        {
+            print_indent(item.indent);
+            printf("%s\n", item.title);
+            continue;
+        }
+        if (!item.unit)
+            continue;
+
+        // 打印类型标题
+        print_indent(item.indent);
+        printf("[%s]", statement_unit_name(item.unit->type));
+
+        if (token_printed)
+        {
+            if (token_range_size(item.unit->tokens) > 0)
+            {
+                printf("  ");
+                print_tokens(item.unit->tokens);
+            }
+        }
+        printf("\n");
+
+        push_print_children(stack, item.unit, item.indent);
+    }
+
+    vector_free(stack);
 }
@@ -2,13 +2,14 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_break_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
-StatementUnit *make_continue_statement_unit(Vector *tokens)
+StatementUnit *make_continue_statement_unit(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_CONTINUE;
 
     unit->tokens = tokens;
@@ -16,11 +17,11 @@ StatementUnit *make_continue_statement_unit(Vector *tokens)
     return unit;
 }
 
-StatementUnit *make_break_statement_unit(Vector *tokens)
+StatementUnit *make_break_statement_unit(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_BREAK;
 
     unit->tokens = tokens;
@@ -28,11 +29,11 @@ StatementUnit *make_break_statement_unit(Vector *tokens)
     return unit;
 }
 
-StatementUnit *make_return_statement_unit(Vector *tokens, StatementUnit *expr)
+StatementUnit *make_return_statement_unit(TokenRange tokens, StatementUnit *expr)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_RETURN;
 
     unit->tokens = tokens;
@@ -45,23 +46,19 @@ void statement_unit_continue_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_CONTINUE)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_break_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_BREAK)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_return_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_RETURN)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->return_stmt.expr);
-    free(unit);
+    mem_free(unit);
 }
\ No newline at end of file
@@ -2,13 +2,14 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_compound_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
-StatementUnit *make_compound_statement_unit(Vector *tokens, Vector *units)
+StatementUnit *make_compound_statement_unit(TokenRange tokens, Vector *units)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_COMPOUND;
 
     unit->tokens = tokens;
@@ -17,11 +18,11 @@ StatementUnit *make_compound_statement_unit(Vector *tokens, Vector *units)
     return unit;
 }
 
-StatementUnit *make_empty_statement_unit(Vector *tokens)
+StatementUnit *make_empty_statement_unit(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_EMPTY;
 
     unit->tokens = tokens;
@@ -29,11 +30,11 @@ StatementUnit *make_empty_statement_unit(Vector *tokens)
     return unit;
 }
 
-StatementUnit *make_preprocessor_statement_unit(Vector *tokens)
+StatementUnit *make_preprocessor_statement_unit(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_PREPROCESSOR;
 
     unit->tokens = tokens;
@@ -45,28 +46,20 @@ void statement_unit_compound_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_COMPOUND)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    if (unit->compound_stmt.units)
-    {
-        for (size_t idx = 0; idx < unit->compound_stmt.units->size; ++idx)
-            statement_unit_free(*((StatementUnit **)vector_get(unit->compound_stmt.units, idx)));
-        vector_free(unit->compound_stmt.units);
-    }
-    free(unit);
+    vector_free(unit->compound_stmt.units);
+    mem_free(unit);
 }
 
 void statement_unit_empty_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_EMPTY)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_preprocessor_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_PREPROCESSOR)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
\ No newline at end of file
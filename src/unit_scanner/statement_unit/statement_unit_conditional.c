@@ -2,17 +2,18 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_conditional_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 StatementUnit *make_if_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *cond,
     StatementUnit *then_body,
     StatementUnit *else_body)
 {
-    if (!tokens || !cond || !then_body)
+    if (!tokens.vec || !cond || !then_body)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_IF;
 
     unit->tokens = tokens;
@@ -24,13 +25,13 @@ StatementUnit *make_if_statement_unit(
 }
 
 StatementUnit *make_switch_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *expr,
     StatementUnit *body)
 {
-    if (!tokens || !expr || !body)
+    if (!tokens.vec || !expr || !body)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_SWITCH;
 
     unit->tokens = tokens;
@@ -40,11 +41,11 @@ StatementUnit *make_switch_statement_unit(
     return unit;
 }
 
-StatementUnit *make_case_statement_unit(Vector *tokens, StatementUnit *expr)
+StatementUnit *make_case_statement_unit(TokenRange tokens, StatementUnit *expr)
 {
-    if (!tokens || !expr)
+    if (!tokens.vec || !expr)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_CASE;
 
     unit->tokens = tokens;
@@ -53,11 +54,11 @@ StatementUnit *make_case_statement_unit(Vector *tokens, StatementUnit *expr)
     return unit;
 }
 
-StatementUnit *make_default_statement_unit(Vector *tokens, int dummy)
+StatementUnit *make_default_statement_unit(TokenRange tokens, int dummy)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_DEFAULT;
 
     unit->tokens = tokens;
@@ -70,36 +71,26 @@ void statement_unit_if_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_IF)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->if_stmt.cond);
-    statement_unit_free(unit->if_stmt.then_body);
-    statement_unit_free(unit->if_stmt.else_body);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_switch_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_SWITCH)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->switch_stmt.expr);
-    statement_unit_free(unit->switch_stmt.body);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_case_free(StatementUnit *unit)
 {
-    if (!unit || unit->type != SUT_DEFAULT)
+    if (!unit || unit->type != SUT_CASE)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->case_stmt.expr);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_default_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_DEFAULT)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
\ No newline at end of file
@@ -2,13 +2,14 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_decl_or_expr_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
-StatementUnit *make_decl_or_expr_statement_unit(Vector *tokens)
+StatementUnit *make_decl_or_expr_statement_unit(TokenRange tokens)
 {
-    if (!tokens)
+    if (!tokens.vec)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_DECL_OR_EXPR;
 
     unit->tokens = tokens;
@@ -20,6 +21,5 @@ void statement_unit_decl_or_expr_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_DECL_OR_EXPR)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    free(unit);
+    mem_free(unit);
 }
\ No newline at end of file
@@ -3,13 +3,14 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_label_impl.h"
 #include "vector.h"
 #include "utils.h"
+#include "arena.h"
 #include <stdlib.h>
 
-StatementUnit *make_label_statement_unit(Vector *tokens, char *name)
+StatementUnit *make_label_statement_unit(TokenRange tokens, char *name)
 {
-    if (!tokens || !name)
+    if (!tokens.vec || !name)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_LABEL;
 
     unit->tokens = tokens;
@@ -18,11 +19,11 @@ StatementUnit *make_label_statement_unit(Vector *tokens, char *name)
     return unit;
 }
 
-StatementUnit *make_goto_statement_unit(Vector *tokens, char *name)
+StatementUnit *make_goto_statement_unit(TokenRange tokens, char *name)
 {
-    if (!tokens || !name)
+    if (!tokens.vec || !name)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_GOTO;
 
     unit->tokens = tokens;
@@ -35,18 +36,16 @@ void statement_unit_label_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_LABEL)
         return;
-    statement_unit_free_tokens(unit->tokens);
     if (unit->label_stmt.name)
-        free(unit->label_stmt.name);
-    free(unit);
+        mem_free(unit->label_stmt.name);
+    mem_free(unit);
 }
 
 void statement_unit_goto_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_GOTO)
         return;
-    statement_unit_free_tokens(unit->tokens);
     if (unit->goto_stmt.name)
-        free(unit->goto_stmt.name);
-    free(unit);
+        mem_free(unit->goto_stmt.name);
+    mem_free(unit);
 }
\ No newline at end of file
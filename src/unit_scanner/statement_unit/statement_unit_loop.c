@@ -2,16 +2,17 @@
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_impl.h"
 #include "unit_scanner_impl/statement_unit_impl/statement_unit_loop_impl.h"
 #include "vector.h"
+#include "arena.h"
 #include <stdlib.h>
 
 StatementUnit *make_while_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *cond,
     StatementUnit *body)
 {
-    if (!tokens || !cond || !body)
+    if (!tokens.vec || !cond || !body)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_WHILE;
 
     unit->tokens = tokens;
@@ -22,13 +23,13 @@ StatementUnit *make_while_statement_unit(
 }
 
 StatementUnit *make_do_while_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *body,
     StatementUnit *cond)
 {
-    if (!tokens || !body || !cond)
+    if (!tokens.vec || !body || !cond)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_DO_WHILE;
 
     unit->tokens = tokens;
@@ -39,15 +40,15 @@ StatementUnit *make_do_while_statement_unit(
 }
 
 StatementUnit *make_for_statement_unit(
-    Vector *tokens,
+    TokenRange tokens,
     StatementUnit *init,
     StatementUnit *cond,
     StatementUnit *step,
     StatementUnit *body)
 {
-    if (!tokens || !body)
+    if (!tokens.vec || !body)
         return NULL;
-    StatementUnit *unit = calloc(1, sizeof(*unit));
+    StatementUnit *unit = mem_calloc(1, sizeof(*unit));
     unit->type = SUT_FOR;
 
     unit->tokens = tokens;
@@ -63,30 +64,19 @@ void statement_unit_while_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_WHILE)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->while_stmt.cond);
-    statement_unit_free(unit->while_stmt.body);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_do_while_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_DO_WHILE)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->do_while_stmt.body);
-    statement_unit_free(unit->do_while_stmt.cond);
-    free(unit);
+    mem_free(unit);
 }
 
 void statement_unit_for_free(StatementUnit *unit)
 {
     if (!unit || unit->type != SUT_FOR)
         return;
-    statement_unit_free_tokens(unit->tokens);
-    statement_unit_free(unit->for_stmt.init);
-    statement_unit_free(unit->for_stmt.cond);
-    statement_unit_free(unit->for_stmt.step);
-    statement_unit_free(unit->for_stmt.body);
-    free(unit);
+    mem_free(unit);
 }
\ No newline at end of file
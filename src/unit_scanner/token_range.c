@@ -0,0 +1,34 @@
+#include "unit_scanner_impl/token_range.h"
+#include "tokenizer_impl/token.h"
+#include "vector.h"
+
+TokenRange make_token_range(Vector *vec, size_t begin, size_t end)
+{
+    if (!vec || end > vec->size || begin >= end)
+        return (TokenRange){NULL, 0, 0};
+    return (TokenRange){vec, begin, end};
+}
+
+TokenRange token_range_all(Vector *vec)
+{
+    return (TokenRange){vec, 0, vec ? vec->size : 0};
+}
+
+TokenRange token_range_sub(TokenRange range, size_t begin, size_t end)
+{
+    if (end > token_range_size(range))
+        return (TokenRange){NULL, 0, 0};
+    return make_token_range(range.vec, range.begin + begin, range.begin + end);
+}
+
+size_t token_range_size(TokenRange range)
+{
+    return range.vec ? range.end - range.begin : 0;
+}
+
+Token *token_range_get(TokenRange range, size_t idx)
+{
+    if (idx >= token_range_size(range))
+        return NULL;
+    return (Token *)vector_get(range.vec, range.begin + idx);
+}
@@ -8,18 +8,18 @@ StatementUnit *scan_continue(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_CONTINUE)
+    if (peek_kind(us) != T_CONTINUE)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us);
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
         return NULL;
     next_token(us); // ;
 
     StatementUnit *unit = make_continue_statement_unit(
-        vector_slice(us->tokens, pos, us->pos));
+        make_token_range(us->tokens, pos, us->pos));
 
     return unit;
 }
@@ -28,18 +28,18 @@ StatementUnit *scan_break(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_BREAK)
+    if (peek_kind(us) != T_BREAK)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us);
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
         return NULL;
     next_token(us); // ;
 
     StatementUnit *unit = make_break_statement_unit(
-        vector_slice(us->tokens, pos, us->pos));
+        make_token_range(us->tokens, pos, us->pos));
 
     return unit;
 }
@@ -48,7 +48,7 @@ StatementUnit *scan_return(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_RETURN)
+    if (peek_kind(us) != T_RETURN)
         return NULL;
 
     size_t pos = us->pos;
@@ -56,7 +56,7 @@ StatementUnit *scan_return(UnitScanner *us)
 
     StatementUnit *expr = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
     {
         statement_unit_free(expr);
         return NULL;
@@ -64,7 +64,7 @@ StatementUnit *scan_return(UnitScanner *us)
     next_token(us); // ;
 
     StatementUnit *unit = make_return_statement_unit(
-        vector_slice(us->tokens, pos, us->pos), expr);
+        make_token_range(us->tokens, pos, us->pos), expr);
 
     return unit;
 }
\ No newline at end of file
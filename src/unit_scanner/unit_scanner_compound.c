@@ -9,14 +9,14 @@ StatementUnit *scan_empty(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us); // ;
 
     StatementUnit *unit = make_empty_statement_unit(
-        vector_slice(us->tokens, pos, us->pos));
+        make_token_range(us->tokens, pos, us->pos));
 
     return unit;
 }
@@ -25,44 +25,67 @@ StatementUnit *scan_compound(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_LEFT_BRACE)
+    if (peek_kind(us) != T_LEFT_BRACE)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
+static StatementUnit *finish_compound(UnitScanner *us, ScanFrame *frame)
+{
+    return make_compound_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos),
+        frame->units);
+}
+
+ScanStep scan_compound_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_COMPOUND, .pos = us->pos};
     next_token(us); // {
 
-    Vector *units = vector_new(sizeof(StatementUnit *));
-    while (peek_token(us)->type != T_EOF)
+    frame->units = vector_new_small(sizeof(StatementUnit *), 4);
+    if (peek_kind(us) == T_EOF)
     {
-        StatementUnit *ptr = scan_unit(us);
-        vector_push_back(units, &ptr);
-
-        if (peek_token(us)->type == T_RIGHT_BRACE)
-        {
-            next_token(us); // }
-            break;
-        }
+        *out = finish_compound(us, frame);
+        return SCAN_DONE;
     }
 
-    StatementUnit *unit = make_compound_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        units);
+    frame->unit_pos = us->pos;
+    return SCAN_UNIT;
+}
+
+ScanStep scan_compound_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    unit_vec_push(frame->units, child);
+
+    // 无法识别的语句（如 "{ a }" 中的 "a"）不会消耗 Token，
+    // 跳过一个 Token 保证扫描一定能向前推进
+    if (us->pos == frame->unit_pos && peek_kind(us) != T_RIGHT_BRACE)
+        next_token(us);
 
-    return unit;
+    if (peek_kind(us) == T_RIGHT_BRACE)
+        next_token(us); // }
+    else if (peek_kind(us) != T_EOF)
+    {
+        frame->unit_pos = us->pos;
+        return SCAN_UNIT;
+    }
+
+    *out = finish_compound(us, frame);
+    return SCAN_DONE;
 }
 
 StatementUnit *scan_preprocessor(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_PREPROCESS)
+    if (peek_kind(us) != T_PREPROCESS)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us); // #...
 
     StatementUnit *unit = make_preprocessor_statement_unit(
-        vector_slice(us->tokens, pos, us->pos));
+        make_token_range(us->tokens, pos, us->pos));
 
     return unit;
 }
\ No newline at end of file
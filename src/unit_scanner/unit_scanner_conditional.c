@@ -8,77 +8,93 @@ StatementUnit *scan_if(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_IF)
+    if (peek_kind(us) != T_IF)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
-    next_token(us); // if
+// if / switch 共用的开头：关键字 ( cond )
+static int scan_paren_cond(UnitScanner *us, ScanFrame *frame)
+{
+    next_token(us); // if / switch
 
-    if (peek_token(us)->type != T_LEFT_PAREN)
-        return NULL;
+    if (peek_kind(us) != T_LEFT_PAREN)
+        return 0;
     next_token(us); // (
 
-    StatementUnit *cond = scan_decl_or_expression(us);
+    frame->cond = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_RIGHT_PAREN)
+    if (peek_kind(us) != T_RIGHT_PAREN)
     {
-        statement_unit_free(cond);
-        return NULL;
+        statement_unit_free(frame->cond);
+        return 0;
     }
     next_token(us); // )
+    return 1;
+}
+
+ScanStep scan_if_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_IF, .pos = us->pos};
+    *out = NULL;
 
-    StatementUnit *then_body = scan_unit(us);
-    StatementUnit *else_body = NULL;
-    if (peek_token(us)->type == T_ELSE)
+    if (!scan_paren_cond(us, frame))
+        return SCAN_DONE;
+    return SCAN_UNIT; // then
+}
+
+ScanStep scan_if_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    StatementUnit *else_body = child;
+    if (frame->stage++ == 0)
     {
-        next_token(us); // else
-        else_body = scan_unit(us);
+        frame->body = child; // then
+        if (peek_kind(us) == T_ELSE)
+        {
+            next_token(us); // else
+            return SCAN_UNIT;
+        }
+        else_body = NULL;
     }
 
-    StatementUnit *unit = make_if_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        cond, then_body, else_body);
-
-    return unit;
+    *out = make_if_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos),
+        frame->cond, frame->body, else_body);
+    return SCAN_DONE;
 }
 
 StatementUnit *scan_switch(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_SWITCH)
+    if (peek_kind(us) != T_SWITCH)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
-    next_token(us); // switch
-
-    if (peek_token(us)->type != T_LEFT_PAREN)
-        return NULL;
-    next_token(us); // (
-
-    StatementUnit *expr = scan_decl_or_expression(us);
-
-    if (peek_token(us)->type != T_RIGHT_PAREN)
-    {
-        statement_unit_free(expr);
-        return NULL;
-    }
-    next_token(us); // )
-
-    StatementUnit *body = scan_compound(us);
+ScanStep scan_switch_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_SWITCH, .pos = us->pos};
+    *out = NULL;
 
-    StatementUnit *unit = make_switch_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        expr, body);
+    if (!scan_paren_cond(us, frame))
+        return SCAN_DONE;
+    return SCAN_COMPOUND; // body
+}
 
-    return unit;
+ScanStep scan_switch_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    *out = make_switch_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos),
+        frame->cond, child);
+    return SCAN_DONE;
 }
 
 StatementUnit *scan_case(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_CASE)
+    if (peek_kind(us) != T_CASE)
         return NULL;
 
     size_t pos = us->pos;
@@ -86,35 +102,31 @@ StatementUnit *scan_case(UnitScanner *us)
 
     // StatementUnit *expr = scan_identifier(us);
     size_t expr_pos = us->pos;
-    size_t depth = 0;
-    while (peek_token(us)->type != T_EOF)
+    while (peek_kind(us) != T_EOF)
     {
-        if (peek_token(us)->type == T_LEFT_BRACE)
-            depth++;
-        else if (peek_token(us)->type == T_RIGHT_BRACE)
+        TokenType t = peek_kind(us);
+        if (t == T_LEFT_BRACE)
         {
-            if (depth)
-                depth--;
-            else
-            {
-                next_token(us); // )
+            skip_to_match(us);
+            if (peek_kind(us) == T_EOF)
                 break;
-            }
         }
-        else if (depth == 0)
+        else if (t == T_RIGHT_BRACE)
         {
-            if (peek_token(us)->type == T_COLON)
-                break;
+            next_token(us); // }
+            break;
         }
+        else if (t == T_COLON)
+            break;
         next_token(us);
     }
-    if (peek_token(us)->type == T_EOF)
+    if (peek_kind(us) == T_EOF)
         return NULL;
 
     StatementUnit *expr = make_decl_or_expr_statement_unit(
-        vector_slice(us->tokens, expr_pos, us->pos));
+        make_token_range(us->tokens, expr_pos, us->pos));
 
-    if (peek_token(us)->type != T_COLON)
+    if (peek_kind(us) != T_COLON)
     {
         statement_unit_free(expr);
         return NULL;
@@ -122,7 +134,7 @@ StatementUnit *scan_case(UnitScanner *us)
     next_token(us); // :
 
     StatementUnit *unit = make_case_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
+        make_token_range(us->tokens, pos, us->pos),
         expr);
 
     return unit;
@@ -132,18 +144,18 @@ StatementUnit *scan_default(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_DEFAULT)
+    if (peek_kind(us) != T_DEFAULT)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us); // default
 
-    if (peek_token(us)->type != T_COLON)
+    if (peek_kind(us) != T_COLON)
         return NULL;
     next_token(us); // :
 
     StatementUnit *unit = make_default_statement_unit(
-        vector_slice(us->tokens, pos, us->pos), 0);
+        make_token_range(us->tokens, pos, us->pos), 0);
 
     return unit;
 }
\ No newline at end of file
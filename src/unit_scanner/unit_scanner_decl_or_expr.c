@@ -11,32 +11,26 @@ StatementUnit *scan_decl_or_expression(UnitScanner *us)
         return NULL;
 
     size_t start = us->pos;
-    size_t depth = 0;
 
-    while (peek_token(us)->type != T_EOF)
+    while (peek_kind(us) != T_EOF)
     {
-        TokenType t = peek_token(us)->type;
+        TokenType t = peek_kind(us);
 
+        // 括号内的 ';' '{' 不结束语句，整对括号直接跳过
         if (t == T_LEFT_PAREN)
-            depth++;
-        else if (t == T_RIGHT_PAREN)
         {
-            if (depth > 0)
-                depth--;
-            else
-                break;
-        }
-        else if (depth == 0)
-        {
-            if (t == T_SEMICOLON || t == T_LEFT_BRACE)
+            skip_to_match(us);
+            if (peek_kind(us) == T_EOF)
                 break;
         }
+        else if (t == T_RIGHT_PAREN || t == T_SEMICOLON || t == T_LEFT_BRACE)
+            break;
 
         next_token(us);
     }
 
     StatementUnit *unit = make_decl_or_expr_statement_unit(
-        vector_slice(us->tokens, start, us->pos));
+        make_token_range(us->tokens, start, us->pos));
 
     return unit;
 }
\ No newline at end of file
@@ -9,19 +9,19 @@ StatementUnit *scan_label(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_IDENTIFIER)
+    if (peek_kind(us) != T_IDENTIFIER)
         return NULL;
 
     size_t pos = us->pos;
     Token *t = next_token(us); // identifier
 
-    if (peek_token(us)->type != T_COLON)
+    if (peek_kind(us) != T_COLON)
         return NULL;
     next_token(us);
 
     StatementUnit *unit = make_label_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        str_clone(t->str));
+        make_token_range(us->tokens, pos, us->pos),
+        str_n_clone(t->str, t->len));
 
     return unit;
 }
@@ -30,23 +30,23 @@ StatementUnit *scan_goto(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_GOTO)
+    if (peek_kind(us) != T_GOTO)
         return NULL;
 
     size_t pos = us->pos;
     next_token(us); // goto
 
-    if (peek_token(us)->type != T_IDENTIFIER)
+    if (peek_kind(us) != T_IDENTIFIER)
         return NULL;
     Token *t = next_token(us); // identifier
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
         return NULL;
     next_token(us);
 
     StatementUnit *unit = make_goto_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        str_clone(t->str));
+        make_token_range(us->tokens, pos, us->pos),
+        str_n_clone(t->str, t->len));
 
     return unit;
 }
\ No newline at end of file
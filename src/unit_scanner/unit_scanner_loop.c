@@ -8,129 +8,153 @@ StatementUnit *scan_while(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_WHILE)
+    if (peek_kind(us) != T_WHILE)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
+ScanStep scan_while_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_WHILE, .pos = us->pos};
+    *out = NULL;
     next_token(us); // while
 
-    if (peek_token(us)->type != T_LEFT_PAREN)
-        return NULL;
+    if (peek_kind(us) != T_LEFT_PAREN)
+        return SCAN_DONE;
     next_token(us); // (
 
-    StatementUnit *cond = scan_decl_or_expression(us);
+    frame->cond = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_RIGHT_PAREN)
+    if (peek_kind(us) != T_RIGHT_PAREN)
     {
-        statement_unit_free(cond);
-        return NULL;
+        statement_unit_free(frame->cond);
+        return SCAN_DONE;
     }
     next_token(us); // )
 
-    StatementUnit *body = scan_unit(us);
-
-    StatementUnit *unit = make_while_statement_unit(
-        vector_slice(us->tokens, pos, us->pos), cond, body);
+    return SCAN_UNIT; // body
+}
 
-    return unit;
+ScanStep scan_while_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    *out = make_while_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos), frame->cond, child);
+    return SCAN_DONE;
 }
 
 StatementUnit *scan_do_while(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_DO)
+    if (peek_kind(us) != T_DO)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
+ScanStep scan_do_while_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_DO_WHILE, .pos = us->pos};
+    *out = NULL;
     next_token(us); // do
 
-    StatementUnit *body = scan_unit(us);
+    return SCAN_UNIT; // body
+}
+
+ScanStep scan_do_while_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    StatementUnit *body = child;
+    *out = NULL;
 
-    if (peek_token(us)->type != T_WHILE)
+    if (peek_kind(us) != T_WHILE)
     {
         statement_unit_free(body);
-        return NULL;
+        return SCAN_DONE;
     }
     next_token(us); // while
 
-    if (peek_token(us)->type != T_LEFT_PAREN)
-        return NULL;
+    if (peek_kind(us) != T_LEFT_PAREN)
+        return SCAN_DONE;
     next_token(us); // (
 
     StatementUnit *cond = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_RIGHT_PAREN)
+    if (peek_kind(us) != T_RIGHT_PAREN)
     {
         statement_unit_free(cond);
-        return NULL;
+        return SCAN_DONE;
     }
     next_token(us); // )
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
     {
         statement_unit_free(body);
         statement_unit_free(cond);
-        return NULL;
+        return SCAN_DONE;
     }
     next_token(us); // ;
 
-    StatementUnit *unit = make_do_while_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
+    *out = make_do_while_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos),
         body, cond);
-
-    return unit;
+    return SCAN_DONE;
 }
 
 StatementUnit *scan_for(UnitScanner *us)
 {
     if (!us)
         return NULL;
-    if (peek_token(us)->type != T_FOR)
+    if (peek_kind(us) != T_FOR)
         return NULL;
+    return scan_unit(us);
+}
 
-    size_t pos = us->pos;
+ScanStep scan_for_begin(UnitScanner *us, ScanFrame *frame, StatementUnit **out)
+{
+    *frame = (ScanFrame){.type = SUT_FOR, .pos = us->pos};
+    *out = NULL;
     next_token(us); // for
 
-    if (peek_token(us)->type != T_LEFT_PAREN)
-        return NULL;
+    if (peek_kind(us) != T_LEFT_PAREN)
+        return SCAN_DONE;
     next_token(us); // (
 
-    StatementUnit *init = scan_decl_or_expression(us);
+    frame->init = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
     {
-        statement_unit_free(init);
-        return NULL;
+        statement_unit_free(frame->init);
+        return SCAN_DONE;
     }
     next_token(us); // ;
 
-    StatementUnit *cond = scan_decl_or_expression(us);
+    frame->cond = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_SEMICOLON)
+    if (peek_kind(us) != T_SEMICOLON)
     {
-        statement_unit_free(init);
-        statement_unit_free(cond);
-        return NULL;
+        statement_unit_free(frame->init);
+        statement_unit_free(frame->cond);
+        return SCAN_DONE;
     }
     next_token(us); // ;
 
-    StatementUnit *step = scan_decl_or_expression(us);
+    frame->step = scan_decl_or_expression(us);
 
-    if (peek_token(us)->type != T_RIGHT_PAREN)
+    if (peek_kind(us) != T_RIGHT_PAREN)
     {
-        statement_unit_free(init);
-        statement_unit_free(cond);
-        statement_unit_free(step);
-        return NULL;
+        statement_unit_free(frame->init);
+        statement_unit_free(frame->cond);
+        statement_unit_free(frame->step);
+        return SCAN_DONE;
     }
     next_token(us); // )
 
-    StatementUnit *body = scan_unit(us);
-
-    StatementUnit *unit = make_for_statement_unit(
-        vector_slice(us->tokens, pos, us->pos),
-        init, cond, step, body);
+    return SCAN_UNIT; // body
+}
 
-    return unit;
-}
\ No newline at end of file
+ScanStep scan_for_resume(UnitScanner *us, ScanFrame *frame, StatementUnit *child, StatementUnit **out)
+{
+    *out = make_for_statement_unit(
+        make_token_range(us->tokens, frame->pos, us->pos),
+        frame->init, frame->cond, frame->step, child);
+    return SCAN_DONE;
+}
@@ -0,0 +1,253 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "unit_scanner.h"
+#include "unit_scanner_impl/unit_scanner_impl.h"
+#include "unit_scanner_impl/statement_unit.h"
+#include "tokenizer_impl/token.h"
+#include "tokenizer_impl/token_stream.h"
+#include "vector.h"
+#include "arena.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+// 每块至少包含的 Token 数，块太小时线程调度的开销会超过收益
+#define SCAN_CHUNK_MIN 8192
+
+// 并行扫描的一块：Token 区间 [begin, end) 及其扫描结果
+typedef struct
+{
+    size_t begin;
+    size_t end;
+    size_t stop;   // 扫描结束时的位置
+    Vector *units; // 扫描得到的顶层语句 (StatementUnit *)
+    int overrun;   // 扫描时越过了 end，结果不可用
+} ScanChunk;
+
+typedef struct
+{
+    UnitScanner *us;
+    ScanChunk *chunks;
+    size_t count;
+    atomic_size_t next; // 下一个待领取的块
+    int use_arena;      // 调用者有活动的 Arena 时，各线程也使用 Arena
+    Arena **arenas;     // arenas[i] 为第 i 个工作线程的 Arena
+} ParallelScan;
+
+typedef struct
+{
+    ParallelScan *ps;
+    size_t id;
+} ScanWorker;
+
+/**
+ * 在顶层的 ';' / '}' 之后切块，括号内部整体跳过。
+ * 切分只是推测：块尾的语句若还需要查看后面的 Token，
+ * 扫描时会被 overrun 标记出来，在拼接时纠正。
+ */
+static Vector *split_chunks(UnitScanner *us, size_t chunk_size)
+{
+    const TokenStream *ts = us->stream;
+    Vector *chunks = vector_new(sizeof(ScanChunk));
+    size_t n = ts->size, begin = 0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        TokenType t = token_stream_kind(ts, i);
+        if (t == T_LEFT_PAREN || t == T_LEFT_BRACKET || t == T_LEFT_BRACE)
+        {
+            // 没有闭合的括号一直延伸到文件末尾，之后不再切分
+            size_t match = token_stream_match(ts, i);
+            if (token_stream_kind(ts, match) == T_EOF)
+                break;
+            i = match;
+            t = token_stream_kind(ts, i);
+        }
+
+        if ((t != T_SEMICOLON && t != T_RIGHT_BRACE) || i + 1 - begin < chunk_size)
+            continue;
+
+        // 明显与前一条语句相连的情况不切，减少重扫
+        TokenType next = token_stream_kind(ts, i + 1);
+        if (next == T_ELSE || next == T_WHILE || next == T_EOF)
+            continue;
+
+        ScanChunk c = {begin, i + 1, 0, NULL, 0};
+        vector_push_back(chunks, &c);
+        begin = i + 1;
+    }
+
+    ScanChunk last = {begin, n, 0, NULL, 0};
+    vector_push_back(chunks, &last);
+    return chunks;
+}
+
+// 与 scan_file 的循环相同，只是扫描范围限制在块内
+static void scan_chunk(UnitScanner *us, ScanChunk *c)
+{
+    UnitScanner sub = *us; // 共享 tokens 和 stream
+    sub.frames = frame_vec_new();
+    sub.pos = c->begin;
+    sub.end = c->end;
+    sub.overrun = 0;
+
+    c->units = unit_vec_new();
+    while (sub.pos < sub.end && peek_kind(&sub) != T_EOF)
+    {
+        size_t unit_pos = sub.pos;
+        unit_vec_push(c->units, scan_unit(&sub));
+
+        if (sub.pos == unit_pos)
+            next_token(&sub);
+    }
+
+    c->stop = sub.pos;
+    c->overrun = sub.overrun;
+    vector_free(sub.frames);
+}
+
+static void *scan_worker(void *arg)
+{
+    ScanWorker *w = arg;
+    ParallelScan *ps = w->ps;
+
+    if (ps->use_arena)
+    {
+        ps->arenas[w->id] = arena_new(0);
+        arena_use(ps->arenas[w->id]);
+    }
+
+    size_t idx;
+    while ((idx = atomic_fetch_add(&ps->next, 1)) < ps->count)
+        scan_chunk(ps->us, &ps->chunks[idx]);
+
+    if (ps->use_arena)
+        arena_use(NULL);
+    return NULL;
+}
+
+static void discard_chunk(ScanChunk *c)
+{
+    for (size_t i = 0; i < c->units->size; ++i)
+        statement_unit_free(unit_vec_at(c->units, i));
+    vector_free(c->units);
+    c->units = NULL;
+}
+
+/**
+ * 按顺序拼接各块的结果。
+ * 第一块从文件开头开始，它的起点一定是顺序扫描时的语句边界；
+ * 一块没有 overrun 时，它看到的 Token 与顺序扫描完全相同，
+ * 因此结果相同，且恰好停在下一块的起点。
+ * 出现 overrun 时从该块起点顺序重扫，直到与后面某一块的起点对齐为止。
+ */
+static void stitch_chunks(UnitScanner *us, ScanChunk *chunks, size_t count, Vector *units)
+{
+    size_t k = 0;
+    while (k < count)
+    {
+        ScanChunk *c = &chunks[k];
+        if (!c->overrun)
+        {
+            vector_extend_from(units, c->units);
+            vector_free(c->units);
+            us->pos = c->stop;
+            k++;
+            continue;
+        }
+
+        discard_chunk(c);
+        us->pos = c->begin;
+        k++;
+        while (peek_kind(us) != T_EOF)
+        {
+            size_t unit_pos = us->pos;
+            unit_vec_push(units, scan_unit(us));
+
+            if (us->pos == unit_pos)
+                next_token(us);
+
+            // 被重扫越过的块作废
+            while (k < count && chunks[k].begin < us->pos)
+                discard_chunk(&chunks[k++]);
+            if (k < count && chunks[k].begin == us->pos)
+                break;
+        }
+        while (k < count && peek_kind(us) == T_EOF)
+            discard_chunk(&chunks[k++]);
+    }
+}
+
+StatementUnit *scan_file_parallel(UnitScanner *us, size_t threads)
+{
+    if (!us)
+        return NULL;
+
+    if (threads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    size_t n = us->stream->size;
+    size_t chunk_size = n / (threads * 4);
+    if (chunk_size < SCAN_CHUNK_MIN)
+        chunk_size = SCAN_CHUNK_MIN;
+    if (threads < 2 || n < 2 * chunk_size)
+        return scan_file(us);
+
+    Vector *chunks = split_chunks(us, chunk_size);
+    if (chunks->size < 2)
+    {
+        vector_free(chunks);
+        return scan_file(us);
+    }
+    if (threads > chunks->size)
+        threads = chunks->size;
+
+    ParallelScan ps;
+    ps.us = us;
+    ps.chunks = chunks->data;
+    ps.count = chunks->size;
+    atomic_init(&ps.next, 0);
+    ps.use_arena = arena_current() != NULL;
+    ps.arenas = mem_calloc(threads, sizeof(Arena *));
+
+    // 当前线程也作为 0 号工作线程参与扫描；
+    // 创建线程失败时剩下的块由已有的线程领取，结果不受影响
+    pthread_t *tids = mem_calloc(threads, sizeof(pthread_t));
+    ScanWorker *workers = mem_calloc(threads, sizeof(ScanWorker));
+    size_t started = 0;
+    for (size_t i = 1; i < threads; ++i)
+    {
+        workers[i] = (ScanWorker){&ps, i};
+        if (pthread_create(&tids[started], NULL, scan_worker, &workers[i]) == 0)
+            started++;
+    }
+
+    // 0 号线程沿用调用者的 Arena
+    for (size_t idx; (idx = atomic_fetch_add(&ps.next, 1)) < ps.count;)
+        scan_chunk(us, &ps.chunks[idx]);
+
+    for (size_t i = 0; i < started; ++i)
+        pthread_join(tids[i], NULL);
+    mem_free(tids);
+    mem_free(workers);
+
+    if (ps.use_arena)
+    {
+        if (!us->arenas)
+            us->arenas = vector_new(sizeof(Arena *));
+        for (size_t i = 1; i < threads; ++i)
+            if (ps.arenas[i])
+                vector_push_back(us->arenas, &ps.arenas[i]);
+    }
+    mem_free(ps.arenas);
+
+    Vector *units = unit_vec_new();
+    stitch_chunks(us, ps.chunks, ps.count, units);
+    vector_free(chunks);
+
+    return make_compound_statement_unit(token_range_all(us->tokens), units);
+}
@@ -1,4 +1,5 @@
 #include "utils.h"
+#include "arena.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -36,7 +37,7 @@ char *str_clone(const char *str)
     if (!str)
         return NULL;
     size_t len = strlen(str) + 1;
-    char *p = malloc(len);
+    char *p = mem_alloc(len);
     memcpy(p, str, len);
     return p;
 }
@@ -45,7 +46,7 @@ char *str_n_clone(const char *str, size_t n)
 {
     if (!str || !n)
         return NULL;
-    char *p = malloc(n + 1);
+    char *p = mem_alloc(n + 1);
     memcpy(p, str, n);
     p[n] = '\0';
     return p;
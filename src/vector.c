@@ -1,4 +1,5 @@
 #include "vector.h"
+#include "arena.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -7,12 +8,41 @@ Vector *vector_new(size_t ele_size)
 {
     if (!ele_size)
         return NULL;
-    Vector *vec = (Vector *)malloc(sizeof(*vec));
+    Vector *vec = (Vector *)mem_alloc(sizeof(*vec));
 
     vec->data = NULL;
     vec->size = 0;
     vec->capacity = 0;
     vec->ele_size = ele_size;
+    vec->inline_cap = 0;
+
+    return vec;
+}
+
+// 内联存储紧跟在结构体之后
+static void *inline_data(Vector *vec) { return vec + 1; }
+
+static int is_inline(Vector *vec)
+{
+    return vec->inline_cap && vec->data == inline_data(vec);
+}
+
+Vector *vector_new_small(size_t ele_size, size_t inline_cap)
+{
+    if (!ele_size)
+        return NULL;
+    if (!inline_cap)
+        return vector_new(ele_size);
+
+    Vector *vec = (Vector *)mem_alloc(sizeof(*vec) + inline_cap * ele_size);
+    if (!vec)
+        return NULL;
+
+    vec->data = inline_data(vec);
+    vec->size = 0;
+    vec->capacity = inline_cap;
+    vec->ele_size = ele_size;
+    vec->inline_cap = inline_cap;
 
     return vec;
 }
@@ -21,9 +51,9 @@ void vector_free(Vector *vec)
 {
     if (!vec)
         return;
-    if (vec->data)
-        free(vec->data);
-    free(vec);
+    if (vec->data && !is_inline(vec))
+        mem_free(vec->data);
+    mem_free(vec);
     vec = NULL;
 }
 
@@ -55,8 +85,32 @@ int vector_reserve(Vector *vec, size_t new_cap)
 {
     if (new_cap <= vec->capacity)
         return 1;
+    if (new_cap < vec->capacity * 2)
+        new_cap = vec->capacity * 2;
+    return vector_reserve_exact(vec, new_cap);
+}
+
+int vector_reserve_exact(Vector *vec, size_t new_cap)
+{
+    if (new_cap <= vec->capacity)
+        return 1;
+
+    // 内联存储不能 realloc，溢出时搬到堆上
+    if (is_inline(vec))
+    {
+        void *heap = mem_alloc(new_cap * vec->ele_size);
+        if (!heap)
+            return 0;
+        memcpy(heap, vec->data, vec->size * vec->ele_size);
+        vec->data = heap;
+        vec->capacity = new_cap;
+        return 1;
+    }
 
-    void *new_data = realloc(vec->data, new_cap * vec->ele_size);
+    void *new_data = mem_realloc(
+        vec->data,
+        vec->capacity * vec->ele_size,
+        new_cap * vec->ele_size);
     if (!new_data)
         return 0;
 
@@ -65,6 +119,44 @@ int vector_reserve(Vector *vec, size_t new_cap)
     return 1;
 }
 
+int vector_shrink_to_fit(Vector *vec)
+{
+    if (!vec)
+        return 0;
+    if (vec->size == vec->capacity || is_inline(vec))
+        return 1;
+
+    void *old = vec->data;
+    // 只有带内联存储的 Vector 才能搬回去，普通 Vector 的 vec + 1 不属于它；
+    // 清空后的小 Vector 同样回到内联存储，下次 push 不必再分配
+    if (vec->inline_cap && vec->size <= vec->inline_cap)
+    {
+        memcpy(inline_data(vec), old, vec->size * vec->ele_size);
+        vec->data = inline_data(vec);
+        vec->capacity = vec->inline_cap;
+        mem_free(old);
+        return 1;
+    }
+    if (!vec->size)
+    {
+        mem_free(old);
+        vec->data = NULL;
+        vec->capacity = 0;
+        return 1;
+    }
+
+    void *new_data = mem_realloc(
+        old,
+        vec->capacity * vec->ele_size,
+        vec->size * vec->ele_size);
+    if (!new_data)
+        return 0;
+
+    vec->data = new_data;
+    vec->capacity = vec->size;
+    return 1;
+}
+
 int vector_resize(Vector *vec, size_t new_size)
 {
     size_t origin_size = vec->size;
@@ -84,7 +176,7 @@ int vector_resize(Vector *vec, size_t new_size)
 int vector_push_back(Vector *vec, void *elem)
 {
     if (!vec)
-        return NULL;
+        return 0;
 
     if (vec->size == vec->capacity)
     {
@@ -100,6 +192,49 @@ int vector_push_back(Vector *vec, void *elem)
     return 1;
 }
 
+int vector_append_n(Vector *vec, const void *elems, size_t n)
+{
+    if (!vec || (n && !elems))
+        return 0;
+    if (!n)
+        return 1;
+    if (!vector_reserve(vec, vec->size + n))
+        return 0;
+
+    memcpy(
+        (char *)vec->data + vec->size * vec->ele_size,
+        elems, n * vec->ele_size);
+    vec->size += n;
+    return 1;
+}
+
+int vector_extend_from(Vector *vec, Vector *src)
+{
+    if (!vec || !src || vec->ele_size != src->ele_size)
+        return 0;
+
+    // src 为 vec 自身时扩容会移动数据，先扩容再取地址
+    size_t n = src->size;
+    if (!vector_reserve(vec, vec->size + n))
+        return 0;
+    return vector_append_n(vec, src->data, n);
+}
+
+void *vector_emplace_back(Vector *vec)
+{
+    if (!vec)
+        return NULL;
+
+    if (vec->size == vec->capacity)
+    {
+        size_t new_cap = vec->capacity ? vec->capacity * 2 : 4;
+        if (!vector_reserve(vec, new_cap))
+            return NULL;
+    }
+
+    return (char *)vec->data + (vec->size++) * vec->ele_size;
+}
+
 int vector_pop_back(Vector *vec)
 {
     if (!vec || vec->size == 0)
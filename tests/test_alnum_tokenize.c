@@ -7,7 +7,7 @@ int main()
     Token *t = next(tk);
     while (t->type != T_EOF)
     {
-        print_token(t);
+        print_token(t, NULL);
         token_free(t);
         t = next(tk);
     }
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "arena.h"
+#include "vector.h"
+#include "tokenizer.h"
+#include "unit_scanner.h"
+#include "unit_scanner_impl/statement_unit.h"
+
+static void test_basic_alloc(void)
+{
+    printf("[TEST] arena basic alloc...\n");
+
+    Arena *arena = arena_new(128);
+    assert(arena);
+
+    char *a = arena_alloc(arena, 3);
+    char *b = arena_alloc(arena, 5);
+    assert(a && b && a != b);
+    assert((uintptr_t)b % sizeof(void *) == 0);
+
+    memcpy(a, "ab", 3);
+    memcpy(b, "cdef", 5);
+    assert(strcmp(a, "ab") == 0);
+    assert(strcmp(b, "cdef") == 0);
+
+    // 超过 Block 大小的分配单独成块
+    char *big = arena_alloc(arena, 1024);
+    assert(big);
+    memset(big, 0x5a, 1024);
+    assert(strcmp(a, "ab") == 0);
+
+    arena_free(arena);
+    printf("  OK\n");
+}
+
+static size_t count_blocks(const Arena *arena)
+{
+    size_t n = 0;
+    for (const ArenaBlock *b = arena->head; b; b = b->next)
+        n++;
+    return n;
+}
+
+static void test_oversize_keeps_head(void)
+{
+    printf("[TEST] oversize alloc keeps the head block...\n");
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+
+    char *a = mem_alloc(100);
+    ArenaBlock *head = arena->head;
+
+    // 超大对象挂在 head 之后，head 的剩余空间继续使用
+    char *big = mem_alloc(100 * 1024);
+    assert(big && arena->head == head && count_blocks(arena) == 2);
+    memset(big, 0x5a, 100 * 1024);
+
+    // 最近一次分配在单独的 Block 中，原地缩小也要用它自己的 Block
+    assert(mem_realloc(big, 100 * 1024, 50 * 1024) == big);
+    assert(arena->last_block->used == 50 * 1024);
+
+    char *c = mem_alloc(100);
+    assert(c > a && c < head->data + head->size);
+    assert(arena->head == head && count_blocks(arena) == 2);
+    assert(big[50 * 1024 - 1] == 0x5a);
+
+    arena_use(prev);
+    arena_free(arena);
+    printf("  OK\n");
+}
+
+static void test_mem_hooks(void)
+{
+    printf("[TEST] mem_* follow the active arena...\n");
+
+    assert(arena_current() == NULL);
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+    assert(prev == NULL);
+    assert(arena_current() == arena);
+
+    int *zeros = mem_calloc(16, sizeof(int));
+    for (int i = 0; i < 16; ++i)
+        assert(zeros[i] == 0);
+
+    // 最近一次分配可以原地扩容
+    int *grown = mem_realloc(zeros, 16 * sizeof(int), 32 * sizeof(int));
+    assert(grown == zeros);
+
+    // 非末尾的分配扩容时会拷贝
+    int *other = mem_alloc(sizeof(int));
+    grown[3] = 42;
+    int *moved = mem_realloc(grown, 32 * sizeof(int), 64 * sizeof(int));
+    assert(moved != grown);
+    assert(moved[3] == 42);
+    (void)other;
+
+    mem_free(moved); // Arena 模式下什么都不做
+
+    arena_use(prev);
+    assert(arena_current() == NULL);
+    arena_free(arena);
+
+    printf("  OK\n");
+}
+
+static void test_vector_in_arena(void)
+{
+    printf("[TEST] vector growth inside arena...\n");
+
+    Arena *arena = arena_new(256);
+    Arena *prev = arena_use(arena);
+
+    Vector *vec = vector_new(sizeof(int));
+    for (int i = 0; i < 1000; ++i)
+        vector_push_back(vec, &i);
+    for (int i = 0; i < 1000; ++i)
+        assert(*(int *)vector_get(vec, i) == i);
+
+    arena_use(prev);
+    arena_free(arena);
+
+    printf("  OK\n");
+}
+
+static void test_pipeline_in_arena(void)
+{
+    printf("[TEST] tokenize + scan inside arena...\n");
+
+    const char *src =
+        "int main() {"
+        "  int a = 1;"
+        "  if (a) { return a; } else { goto out; }"
+        "  for (;;) { while (a) a--; }"
+        "  out: return 0;"
+        "}";
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+
+    Vector *tokens = tokenize_all(src);
+    UnitScanner *us = unit_scanner_new(tokens);
+    StatementUnit *root = scan_file(us);
+    assert(root && root->type == SUT_COMPOUND);
+    assert(root->compound_stmt.units->size == 2);
+
+    // 无需逐个释放，下面的调用都是空操作
+    statement_unit_free(root);
+    unit_scanner_free(us);
+
+    arena_use(prev);
+    arena_free(arena);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    printf("==== Arena Test Begin ====\n");
+
+    test_basic_alloc();
+    test_oversize_keeps_head();
+    test_mem_hooks();
+    test_vector_in_arena();
+    test_pipeline_in_arena();
+
+    printf("==== Arena Test All Passed ====\n");
+    return 0;
+}
@@ -28,9 +28,10 @@ static DeclInitializer *wrap_decl(Declarator *d)
 
 static StatementUnit *fake_expr_stmt(const char *repr)
 {
-    Vector *tokens = vec_new_ptr();
+    // 语句单元只保存区间视图，空数组用静态对象即可，无需释放
+    static Vector tokens = {NULL, 0, 0, sizeof(void *), 0};
     (void)repr;
-    return make_decl_or_expr_statement_unit(tokens);
+    return make_decl_or_expr_statement_unit(token_range_all(&tokens));
 }
 
 static void test_simple_decl(void)
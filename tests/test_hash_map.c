@@ -49,12 +49,12 @@ static void test_basic_insert_find(void)
     printf("  OK\n");
 }
 
-/* 强制制造 hash 冲突：小桶数 */
+/* 最小容量下的多个 key */
 static void test_collision_chain(void)
 {
-    printf("[TEST] hash collision chain...\n");
+    printf("[TEST] small map probing...\n");
 
-    HashMap *map = make_hash_map(1); // 所有 key 进同一个桶
+    HashMap *map = make_hash_map(1); // 只有一组槽位
 
     int v1 = 1, v2 = 2, v3 = 3;
 
@@ -131,6 +131,65 @@ static void test_null_key_behavior(void)
     printf("  OK (or intentionally asserted)\n");
 }
 
+/* 插入远超初始容量的 key，触发多次扩容 */
+static void test_growth(void)
+{
+    printf("[TEST] growth keeps every entry...\n");
+
+    HashMap *map = make_hash_map(0);
+    static int vals[10000];
+    char buf[32];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        vals[i] = i;
+        snprintf(buf, sizeof(buf), "sym_%d", i);
+        assert(hash_map_insert(map, buf, &vals[i]));
+    }
+    assert(map->size == 10000);
+    assert(map->size * 8 <= map->capacity * 7);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        snprintf(buf, sizeof(buf), "sym_%d", i);
+        HashEntry *e = hash_map_find(map, buf);
+        assert(e && e->value == &vals[i]);
+        assert(strcmp(e->key, buf) == 0);
+    }
+    assert(hash_map_find(map, "sym_10000") == NULL);
+
+    hash_map_free(map);
+    printf("  OK\n");
+}
+
+static void test_id_keys(void)
+{
+    printf("[TEST] integer id keys...\n");
+
+    HashMap *map = make_hash_map(4);
+    static int vals[3000];
+
+    // 连续的 id 是驻留表的典型分布
+    for (uint32_t id = 1; id <= 3000; ++id)
+        assert(hash_map_insert_id(map, id, &vals[id - 1]));
+    for (uint32_t id = 1; id <= 3000; ++id)
+    {
+        HashEntry *e = hash_map_find_id(map, id);
+        assert(e && e->id == id && e->key == NULL);
+        assert(e->value == &vals[id - 1]);
+    }
+    assert(hash_map_find_id(map, 3001) == NULL);
+    assert(hash_map_find_id(map, 0) == NULL);
+
+    // 字符串 key 与 id key 可以共存，互不干扰
+    hash_map_insert(map, "name", &vals[0]);
+    assert(hash_map_find(map, "name")->value == &vals[0]);
+    assert(hash_map_find_id(map, 1)->value == &vals[0]);
+
+    hash_map_free(map);
+    printf("  OK\n");
+}
+
 /* ---------- 总入口 ---------- */
 
 void test_hash_map_all(void)
@@ -143,6 +202,8 @@ void test_hash_map_all(void)
     test_duplicate_key();
     test_empty_key();
     test_null_key_behavior();
+    test_growth();
+    test_id_keys();
 
     printf("==== HashMap Test All Passed ====\n");
 }
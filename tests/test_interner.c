@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "interner.h"
+#include "hash_map.h"
+#include "tokenizer.h"
+#include "vector.h"
+#include "decl_parser_impl/scope.h"
+
+static void test_intern_basic(void)
+{
+    printf("[TEST] intern basic...\n");
+
+    uint32_t a = intern_id("alpha", 5);
+    uint32_t b = intern_id("beta", 4);
+    assert(a && b && a != b);
+
+    // 文本相同则 id 相同，不要求 '\0' 结尾
+    assert(intern_id("alphabet", 5) == a);
+    assert(intern_find("beta", 4) == b);
+    assert(intern_find("gamma", 5) == 0);
+
+    size_t len;
+    const char *name = intern_name(a, &len);
+    assert(len == 5 && strcmp(name, "alpha") == 0);
+    assert(intern_name(0, NULL) == NULL);
+
+    printf("  OK\n");
+}
+
+static void test_intern_growth(void)
+{
+    printf("[TEST] intern growth...\n");
+
+    char buf[32];
+    uint32_t ids[5000];
+    for (int i = 0; i < 5000; ++i)
+    {
+        int n = snprintf(buf, sizeof(buf), "ident_%d", i);
+        ids[i] = intern_id(buf, (size_t)n);
+        assert(ids[i]);
+    }
+    for (int i = 0; i < 5000; ++i)
+    {
+        int n = snprintf(buf, sizeof(buf), "ident_%d", i);
+        assert(intern_find(buf, (size_t)n) == ids[i]);
+        assert(strcmp(intern_name(ids[i], NULL), buf) == 0);
+    }
+
+    printf("  OK\n");
+}
+
+static void test_token_ids(void)
+{
+    printf("[TEST] tokens carry intern ids...\n");
+
+    Vector *t1 = tokenize_all("int count = count + limit;");
+    Vector *t2 = tokenize_all("limit--;");
+
+    Token *kw = vector_get(t1, 0);
+    Token *c1 = vector_get(t1, 1);
+    Token *c2 = vector_get(t1, 3);
+    Token *l1 = vector_get(t1, 5);
+    Token *l2 = vector_get(t2, 0);
+
+    assert(kw->type == T_INT && kw->id == 0);
+    assert(c1->id && c1->id == c2->id);
+    assert(l1->id && l1->id != c1->id);
+    assert(l1->id == l2->id); // 跨文件共享
+    assert(((Token *)vector_get(t1, 2))->id == 0);
+
+    vector_free(t1);
+    vector_free(t2);
+
+    printf("  OK\n");
+}
+
+static void test_scope_by_id(void)
+{
+    printf("[TEST] scope lookup by id...\n");
+
+    // 这里只关心查找，Symbol 的内容无关紧要
+    static int dummy_a, dummy_b;
+    Symbol *sa = (Symbol *)&dummy_a, *sb = (Symbol *)&dummy_b;
+
+    uint32_t x = intern_id("x", 1), y = intern_id("y", 1);
+
+    Scope *outer = scope_enter(NULL, SYM_OBJECT);
+    Scope *inner = scope_enter(outer, SYM_OBJECT);
+
+    assert(identifier_insert(outer, x, sa) == sa);
+    assert(identifier_insert(inner, y, sb) == sb);
+    assert(identifier_insert(inner, y, sa) == sb); // 已存在时不覆盖
+
+    assert(identifier_lookup(inner, x) == sa);
+    assert(identifier_lookup(inner, y) == sb);
+    assert(identifier_lookup(outer, y) == NULL);
+    assert(tag_lookup(inner, x) == NULL);
+
+    scope_free(inner);
+    scope_free(outer);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_intern_basic();
+    test_intern_growth();
+    test_token_ids();
+    test_scope_by_id();
+
+    intern_clear();
+    assert(intern_count() == 0);
+    return 0;
+}
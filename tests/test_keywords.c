@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "tokenizer_impl/line_index.h"
+#include "vector.h"
+
+typedef struct
+{
+    const char *text;
+    TokenType type;
+} KwCase;
+
+static const KwCase kw_cases[] = {
+    {"extern", T_EXTERN},
+    {"static", T_STATIC},
+    {"inline", T_INLINE},
+    {"register", T_REGISTER},
+    {"restrict", T_RESTRICT},
+    {"volatile", T_VOLATILE},
+    {"const", T_CONST},
+
+    {"auto", T_AUTO},
+    {"void", T_VOID},
+    {"signed", T_SIGNED},
+    {"unsigned", T_UNSIGNED},
+    {"char", T_CHAR},
+    {"short", T_SHORT},
+    {"int", T_INT},
+    {"long", T_LONG},
+    {"float", T_FLOAT},
+    {"double", T_DOUBLE},
+
+    {"do", T_DO},
+    {"while", T_WHILE},
+    {"for", T_FOR},
+    {"continue", T_CONTINUE},
+    {"break", T_BREAK},
+    {"if", T_IF},
+    {"else", T_ELSE},
+    {"switch", T_SWITCH},
+    {"case", T_CASE},
+    {"default", T_DEFAULT},
+    {"return", T_RETURN},
+    {"goto", T_GOTO},
+
+    {"enum", T_ENUM},
+    {"sizeof", T_SIZEOF},
+    {"struct", T_STRUCT},
+    {"typedef", T_TYPEDEF},
+    {"union", T_UNION},
+
+    // 前缀、后缀、大小写相近的都应当是普通标识符
+    {"interface", T_IDENTIFIER},
+    {"in", T_IDENTIFIER},
+    {"dou", T_IDENTIFIER},
+    {"doubles", T_IDENTIFIER},
+    {"If", T_IDENTIFIER},
+    {"_if", T_IDENTIFIER},
+    {"if_", T_IDENTIFIER},
+    {"if1", T_IDENTIFIER},
+    {"sizeOf", T_IDENTIFIER},
+    {"structs", T_IDENTIFIER},
+    {"regist3r", T_IDENTIFIER},
+    {"x", T_IDENTIFIER},
+};
+
+static void test_single_words(void)
+{
+    printf("[TEST] keyword classification...\n");
+
+    for (size_t i = 0; i < sizeof(kw_cases) / sizeof(kw_cases[0]); ++i)
+    {
+        Vector *tokens = tokenize_all(kw_cases[i].text);
+        Token *t = vector_get(tokens, 0);
+
+        assert(t->type == kw_cases[i].type);
+        assert(t->len == strlen(kw_cases[i].text));
+        assert(((Token *)vector_get(tokens, 1))->type == T_EOF);
+
+        vector_free(tokens);
+    }
+
+    printf("  OK\n");
+}
+
+static void test_positions(void)
+{
+    printf("[TEST] keyword positions...\n");
+
+    const char *src = "int x;\n  return x1+y;";
+    Vector *tokens = tokenize_all(src);
+    LineIndex *li = line_index_new(src, strlen(src));
+    size_t line, col;
+
+    Token *t = vector_get(tokens, 3); // return
+    assert(t->type == T_RETURN);
+    line_index_locate(li, t->pos, &line, &col);
+    assert(line == 2 && col == 3);
+
+    t = vector_get(tokens, 4); // x1
+    assert(t->type == T_IDENTIFIER && t->len == 2);
+    line_index_locate(li, t->pos, &line, &col);
+    assert(line == 2 && col == 10);
+
+    line_index_free(li);
+    vector_free(tokens);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_single_words();
+    test_positions();
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "tokenizer_impl/line_index.h"
+#include "vector.h"
+
+static void expect_locate(const LineIndex *li, size_t offset, size_t line, size_t col)
+{
+    size_t l, c;
+    line_index_locate(li, offset, &l, &c);
+    assert(l == line && c == col);
+}
+
+static void test_basic(void)
+{
+    printf("[TEST] line index basic...\n");
+
+    const char *src = "ab\n\ncd\nlast";
+    LineIndex *li = line_index_new(src, strlen(src));
+    assert(li->count == 4);
+
+    expect_locate(li, 0, 1, 1);
+    expect_locate(li, 2, 1, 3); // 换行符本身属于所在行
+    expect_locate(li, 3, 2, 1); // 空行
+    expect_locate(li, 5, 3, 2);
+    expect_locate(li, 10, 4, 4);
+    expect_locate(li, strlen(src), 4, 5); // EOF 位置
+
+    line_index_free(li);
+
+    li = line_index_new("", 0);
+    assert(li->count == 1);
+    expect_locate(li, 0, 1, 1);
+    line_index_free(li);
+
+    printf("  OK\n");
+}
+
+static void test_crlf_matches_lf(void)
+{
+    printf("[TEST] CRLF lines match LF lines...\n");
+
+    const char *lf = "int a;\nint b;\n  return a;\n";
+    const char *crlf = "int a;\r\nint b;\r\n  return a;\r\n";
+
+    Vector *t1 = tokenize_all(lf);
+    Vector *t2 = tokenize_all(crlf);
+    LineIndex *l1 = line_index_new(lf, strlen(lf));
+    LineIndex *l2 = line_index_new(crlf, strlen(crlf));
+    assert(t1->size == t2->size);
+
+    for (size_t i = 0; i < t1->size; ++i)
+    {
+        Token *a = vector_get(t1, i), *b = vector_get(t2, i);
+        assert(a->type == b->type && a->len == b->len);
+
+        size_t la, ca, lb, cb;
+        line_index_locate(l1, a->pos, &la, &ca);
+        line_index_locate(l2, b->pos, &lb, &cb);
+        assert(la == lb);
+        if (a->type != T_EOF)
+            assert(ca == cb);
+    }
+
+    line_index_free(l1);
+    line_index_free(l2);
+    vector_free(t1);
+    vector_free(t2);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_basic();
+    test_crlf_matches_lf();
+    return 0;
+}
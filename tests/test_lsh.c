@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "vector.h"
+#include "fingerprint_impl/ngram.h"
+#include "fingerprint_impl/minhash.h"
+#include "fingerprint_impl/lsh.h"
+
+#include "test_util.h"
+
+static void test_params(void)
+{
+    printf("[TEST] lsh params follow threshold...\n");
+
+    double targets[] = {0.3, 0.5, 0.8, 0.95};
+    for (size_t i = 0; i < sizeof(targets) / sizeof(*targets); ++i)
+    {
+        size_t b, r;
+        lsh_params_for_threshold(targets[i], &b, &r);
+        assert(b * r <= MINHASH_SIZE);
+        assert(fabs(pow(1.0 / (double)b, 1.0 / (double)r) - targets[i]) < 0.08);
+    }
+
+    assert(!lsh_index_new(0, 4));
+    assert(!lsh_index_new(MINHASH_SIZE, 2));
+    printf("  OK\n");
+}
+
+static void test_near_duplicates(void)
+{
+    printf("[TEST] lsh finds near duplicates...\n");
+
+    // 40 组文档，每组 3 份：原文、改了 5% 的副本、毫不相干的文档
+    enum { GROUPS = 40, GRAMS = 400 };
+    static NGram base[GRAMS], copy[GRAMS], other[GRAMS];
+    static MinHash sigs[GROUPS * 3];
+
+    size_t bands, rows;
+    lsh_params_for_threshold(0.5, &bands, &rows);
+    LshIndex *idx = lsh_index_new(bands, rows);
+
+    srand(21);
+    for (int g = 0; g < GROUPS; ++g)
+    {
+        for (int i = 0; i < GRAMS; ++i)
+        {
+            base[i] = (NGram){rand64(), 0, (uint32_t)i};
+            copy[i] = i % 20 == 0 ? (NGram){rand64(), 0, (uint32_t)i} : base[i];
+            other[i] = (NGram){rand64(), 0, (uint32_t)i};
+        }
+        minhash_from_ngrams(&sigs[g * 3], base, GRAMS);
+        minhash_from_ngrams(&sigs[g * 3 + 1], copy, GRAMS);
+        minhash_from_ngrams(&sigs[g * 3 + 2], other, GRAMS);
+    }
+    for (uint32_t d = 0; d < GROUPS * 3; ++d)
+        assert(lsh_index_add(idx, &sigs[d]) == d);
+
+    Vector *pairs = lsh_pair_vec_new();
+    assert(lsh_index_candidates(idx, pairs));
+
+    // 每组的原文与副本都是候选，且候选远少于全部 n^2 / 2 对
+    for (uint32_t g = 0; g < GROUPS; ++g)
+    {
+        int found = 0;
+        for (size_t i = 0; i < pairs->size; ++i)
+        {
+            LshPair p = lsh_pair_vec_at(pairs, i);
+            found |= p.a == g * 3 && p.b == g * 3 + 1;
+        }
+        assert(found);
+    }
+    assert(pairs->size < GROUPS * 3);
+
+    // 升序且不重复
+    for (size_t i = 0; i < pairs->size; ++i)
+    {
+        LshPair p = lsh_pair_vec_at(pairs, i);
+        assert(p.a < p.b);
+        if (i)
+        {
+            LshPair q = lsh_pair_vec_at(pairs, i - 1);
+            assert(q.a < p.a || (q.a == p.a && q.b < p.b));
+        }
+    }
+
+    // 查询与候选对一致
+    Vector *hits = vector_new(sizeof(uint32_t));
+    assert(lsh_index_query(idx, &sigs[5 * 3 + 1], hits));
+    int self = 0, orig = 0;
+    for (size_t i = 0; i < hits->size; ++i)
+    {
+        uint32_t d = *(uint32_t *)vector_get(hits, i);
+        self |= d == 5 * 3 + 1;
+        orig |= d == 5 * 3;
+        if (i)
+            assert(*(uint32_t *)vector_get(hits, i - 1) < d);
+    }
+    assert(self && orig);
+
+    vector_free(hits);
+    vector_free(pairs);
+    lsh_index_free(idx);
+    printf("  OK\n");
+}
+
+static void test_empty_signatures(void)
+{
+    printf("[TEST] lsh skips empty signatures...\n");
+
+    LshIndex *idx = lsh_index_new(32, 4);
+    MinHash empty, full;
+    minhash_from_ngrams(&empty, NULL, 0);
+
+    NGram grams[50];
+    srand(33);
+    for (int i = 0; i < 50; ++i)
+        grams[i] = (NGram){rand64(), 0, (uint32_t)i};
+    minhash_from_ngrams(&full, grams, 50);
+
+    // 大量空签名 (如只有 #include 的头文件) 仍然分到编号，但不产生候选对
+    for (uint32_t d = 0; d < 1000; ++d)
+        assert(lsh_index_add(idx, &empty) == d);
+    assert(lsh_index_add(idx, &full) == 1000);
+    assert(lsh_index_add(idx, &full) == 1001);
+
+    Vector *pairs = lsh_pair_vec_new();
+    assert(lsh_index_candidates(idx, pairs));
+    assert(pairs->size == 1);
+    assert(lsh_pair_vec_at(pairs, 0).a == 1000 && lsh_pair_vec_at(pairs, 0).b == 1001);
+
+    Vector *hits = vector_new(sizeof(uint32_t));
+    assert(lsh_index_query(idx, &empty, hits) && hits->size == 0);
+    assert(lsh_index_query(idx, &full, hits) && hits->size == 2);
+
+    vector_free(hits);
+    vector_free(pairs);
+    lsh_index_free(idx);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_params();
+    test_near_duplicates();
+    test_empty_signatures();
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "vector.h"
+#include "fingerprint_impl/ngram.h"
+#include "fingerprint_impl/minhash.h"
+
+#include "test_util.h"
+
+static void fill_random(NGram *grams, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        grams[i] = (NGram){rand64(), 0, (uint32_t)i};
+}
+
+static void test_matches_reference(void)
+{
+    printf("[TEST] minhash matches per-bucket minimum...\n");
+
+    enum { COUNT = 5000 };
+    static NGram grams[COUNT];
+    srand(3);
+    fill_random(grams, COUNT);
+
+    // 逐桶取最小值的朴素实现
+    uint32_t expect[MINHASH_SIZE];
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        expect[i] = MINHASH_EMPTY;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        uint32_t bin = (uint32_t)(grams[i].hash >> (64 - MINHASH_BITS));
+        if ((uint32_t)grams[i].hash < expect[bin])
+            expect[bin] = (uint32_t)grams[i].hash;
+    }
+
+    // 分两次加入与一次加入结果相同
+    MinHash mh;
+    minhash_init(&mh);
+    minhash_add(&mh, grams, 1234);
+    minhash_add(&mh, grams + 1234, COUNT - 1234);
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        assert(mh.v[i] == expect[i]);
+
+    MinHash again;
+    minhash_from_ngrams(&again, grams, COUNT);
+    assert(minhash_similarity(&mh, &again) == 1.0);
+
+    printf("  OK\n");
+}
+
+static void test_jaccard_estimate(void)
+{
+    printf("[TEST] minhash estimates jaccard...\n");
+
+    // a = [0, 3000)，b = [1000, 4000)，Jaccard = 2000 / 4000
+    enum { COUNT = 4000 };
+    static NGram all[COUNT];
+    srand(5);
+    fill_random(all, COUNT);
+
+    MinHash a, b, c;
+    minhash_from_ngrams(&a, all, 3000);
+    minhash_from_ngrams(&b, all + 1000, 3000);
+    double s = minhash_similarity(&a, &b);
+    assert(s > 0.35 && s < 0.65);
+
+    // 互不相交
+    minhash_from_ngrams(&c, all + 3000, 1000);
+    minhash_from_ngrams(&a, all, 1000);
+    assert(minhash_similarity(&a, &c) < 0.1);
+
+    printf("  OK\n");
+}
+
+static void test_densification(void)
+{
+    printf("[TEST] minhash densifies sparse sets...\n");
+
+    NGram grams[5];
+    srand(9);
+    fill_random(grams, 5);
+
+    MinHash a, b;
+    minhash_from_ngrams(&a, grams, 5);
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        assert(a.v[i] != MINHASH_EMPTY);
+
+    // 顺序与重复不影响结果
+    NGram shuffled[7] = {grams[4], grams[2], grams[0], grams[3], grams[1], grams[2], grams[4]};
+    minhash_from_ngrams(&b, shuffled, 7);
+    assert(minhash_similarity(&a, &b) == 1.0);
+
+    // 多一个元素时大部分桶不变
+    NGram more[6] = {grams[0], grams[1], grams[2], grams[3], grams[4]};
+    fill_random(more + 5, 1);
+    minhash_from_ngrams(&b, more, 6);
+    assert(minhash_similarity(&a, &b) > 0.4);
+
+    // 空集合保持为空，且与任何签名 (包括另一个空签名) 都不相似
+    minhash_from_ngrams(&b, NULL, 0);
+    for (size_t i = 0; i < MINHASH_SIZE; ++i)
+        assert(b.v[i] == MINHASH_EMPTY);
+    assert(minhash_is_empty(&b) && !minhash_is_empty(&a));
+    MinHash c;
+    minhash_from_ngrams(&c, NULL, 0);
+    assert(minhash_similarity(&b, &c) == 0.0);
+    assert(minhash_similarity(&a, &b) == 0.0);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_matches_reference();
+    test_jaccard_estimate();
+    test_densification();
+    return 0;
+}
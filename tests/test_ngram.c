@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "vector.h"
+#include "tokenizer_impl/token_stream.h"
+#include "fingerprint_impl/normalize.h"
+#include "fingerprint_impl/ngram.h"
+
+#include "test_util.h"
+
+// 把窗口单独拿出来从头计算一遍哈希
+static uint64_t window_hash(const NormStream *ns, size_t pos, size_t n)
+{
+    NormStream view = {.size = n, .capacity = n, .syms = ns->syms + pos, .offsets = ns->offsets + pos};
+    Vector *one = ngram_vec_new();
+    assert(ngram_hashes(&view, n, 0, one) && one->size == 1);
+    uint64_t h = ngram_vec_at(one, 0).hash;
+    vector_free(one);
+    return h;
+}
+
+static void test_rolling_matches_direct(void)
+{
+    printf("[TEST] rolling hash matches direct hash...\n");
+
+    enum { SYMS = 2000 };
+    uint16_t syms[SYMS];
+    uint32_t offsets[SYMS];
+    srand(11);
+    for (int i = 0; i < SYMS; ++i)
+    {
+        syms[i] = (uint16_t)(rand() % 8); // 小字母表，制造大量重复窗口
+        offsets[i] = (uint32_t)i;
+    }
+    NormStream ns = {.size = SYMS, .capacity = SYMS, .syms = syms, .offsets = offsets};
+
+    size_t sizes[] = {1, 5, 64, 65, 500};
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); ++k)
+    {
+        size_t n = sizes[k];
+        Vector *out = ngram_vec_new();
+        assert(ngram_hashes(&ns, n, 7, out));
+        assert(out->size == SYMS - n + 1);
+
+        for (size_t i = 0; i < out->size; i += 37)
+        {
+            NGram g = ngram_vec_at(out, i);
+            assert(g.file == 7 && g.pos == i);
+            assert(g.hash == window_hash(&ns, i, n));
+        }
+        vector_free(out);
+    }
+
+    printf("  OK\n");
+}
+
+static void test_clone_windows(void)
+{
+    printf("[TEST] clones share window hashes...\n");
+
+    NormStream *a = normalize_src("int f(int x) { return x * 2 + 1; }");
+    NormStream *b = normalize_src("int unrelated; long g(long y);\n"
+                                  "int g2(int q) { return q * 7 + 3; }");
+
+    Vector *ha = ngram_vec_new(), *hb = ngram_vec_new();
+    assert(ngram_hashes(a, 6, 0, ha));
+    assert(ngram_hashes(b, 6, 1, hb));
+
+    // a 的每个窗口都能在 b 中找到，且位置对得上
+    size_t shift = 10; // b 中函数前面多出来的符号数
+    for (size_t i = 0; i < ha->size; ++i)
+    {
+        NGram g = ngram_vec_at(hb, i + shift);
+        assert(g.file == 1 && g.hash == ngram_vec_at(ha, i).hash);
+    }
+    assert(ngram_vec_at(hb, 0).hash != ngram_vec_at(ha, 0).hash);
+
+    // 追加而不是覆盖；符号数不足一个窗口时不产生结果
+    size_t before = ha->size;
+    assert(ngram_hashes(a, a->size + 1, 0, ha));
+    assert(ha->size == before);
+    assert(!ngram_hashes(a, 0, 0, ha));
+
+    vector_free(ha);
+    vector_free(hb);
+    norm_stream_free(a);
+    norm_stream_free(b);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_rolling_matches_direct();
+    test_clone_windows();
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "arena.h"
+#include "vector.h"
+#include "tokenizer_impl/token_stream.h"
+#include "fingerprint_impl/normalize.h"
+
+#include "test_util.h"
+
+static int same_syms(const NormStream *a, const NormStream *b)
+{
+    return a->size == b->size &&
+           memcmp(a->syms, b->syms, a->size * sizeof(uint16_t)) == 0;
+}
+
+static void test_type2_clones(void)
+{
+    printf("[TEST] renamed clones normalize equally...\n");
+
+    NormStream *a = norm_stream_new();
+    NormStream *b = norm_stream_new();
+
+    normalize_into(a, "#include <stdio.h>\n"
+                       "int sum(int *arr, int n) { int s = 0; for (int i = 0; i < n; ++i) s += arr[i]; return s; }");
+    normalize_into(b, "int total(int *v, int len)\n"
+                       "{\n"
+                       "    int acc = 100; // 改了初值\n"
+                       "    for (int k = 0; k < len; ++k)\n"
+                       "        acc += v[k];\n"
+                       "    return acc;\n"
+                       "}\n"
+                       "#define UNUSED 1\n");
+    assert(same_syms(a, b));
+
+    // 结构不同则符号流不同
+    normalize_into(b, "int sum(int *arr, int n) { int s = 0; while (n--) s += arr[n]; return s; }");
+    assert(!same_syms(a, b));
+
+    norm_stream_free(a);
+    norm_stream_free(b);
+    printf("  OK\n");
+}
+
+static void test_symbols_and_offsets(void)
+{
+    printf("[TEST] symbols and offsets...\n");
+
+    const char *src = "#define X 1\nx = 'c' + \"s\" * 3.0;";
+    NormStream *ns = norm_stream_new();
+    normalize_into(ns, src);
+
+    uint16_t expect[] = {T_IDENTIFIER, T_ASSIGN, T_CHARACTER, T_PLUS,
+                         T_STRING, T_STAR, T_NUMBER, T_SEMICOLON};
+    assert(ns->size == sizeof(expect) / sizeof(*expect));
+    for (size_t i = 0; i < ns->size; ++i)
+        assert(ns->syms[i] == expect[i]);
+
+    // 偏移指向源码中对应 Token 的开头
+    assert(src[ns->offsets[0]] == 'x');
+    assert(src[ns->offsets[2]] == '\'');
+    assert(src[ns->offsets[4]] == '"');
+    assert(src[ns->offsets[7]] == ';');
+
+    assert(norm_symbol(T_PREPROCESS) == NORM_DROP);
+    assert(norm_symbol(T_EOF) == NORM_DROP);
+    assert(norm_symbol(T_IDENTIFIER) == T_IDENTIFIER);
+
+    // 复用同一个 NormStream：内容被覆盖
+    normalize_into(ns, "");
+    assert(ns->size == 0);
+
+    norm_stream_free(ns);
+    printf("  OK\n");
+}
+
+static void test_arena_switch(void)
+{
+    printf("[TEST] norm stream keeps its own arena...\n");
+
+    // 在没有 Arena 时创建，在 Arena 中扩容，回到 malloc 后释放
+    NormStream *ns = norm_stream_new();
+    assert(ns && !ns->arena);
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+    normalize_into(ns, "int f(int a) { return a * 2 + g(a, 3); }");
+    assert(ns->size > 0);
+    arena_use(prev);
+
+    // syms / offsets 仍来自 malloc，释放 Arena 后依然可读，并交给 free
+    arena_free(arena);
+    assert(ns->syms[0] == T_INT);
+    norm_stream_free(ns);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_type2_clones();
+    test_symbols_and_offsets();
+    test_arena_switch();
+    return 0;
+}
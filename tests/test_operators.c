@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "tokenizer_impl/line_index.h"
+#include "vector.h"
+
+static void expect_tokens(const char *src, const TokenType *types, size_t n)
+{
+    Vector *tokens = tokenize_all(src);
+    assert(tokens->size == n + 1);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        Token *t = vector_get(tokens, i);
+        if (t->type != types[i])
+        {
+            fprintf(stderr, "  \"%s\" #%zu: got %s, want %s\n",
+                    src, i, token_name(t->type), token_name(types[i]));
+            assert(0);
+        }
+    }
+    assert(((Token *)vector_get(tokens, n))->type == T_EOF);
+
+    vector_free(tokens);
+}
+
+#define EXPECT(src, ...)                                          \
+    do                                                            \
+    {                                                             \
+        const TokenType types[] = {__VA_ARGS__};                  \
+        expect_tokens(src, types, sizeof(types) / sizeof(*types)); \
+    } while (0)
+
+static void test_every_operator(void)
+{
+    printf("[TEST] every operator...\n");
+
+    EXPECT("<<= >>= ...",
+           T_LEFT_SHIFT_ASSIGN, T_RIGHT_SHIFT_ASSIGN, T_ELLIPSIS);
+    EXPECT("-> == != <= >= && ||",
+           T_ARROW, T_EQUAL, T_NOT_EQUAL, T_LESS_EQUAL, T_GREATER_EQUAL,
+           T_AND_AND, T_OR_OR);
+    EXPECT("+= -= *= /= %= &= |= ^=",
+           T_PLUS_ASSIGN, T_MINUS_ASSIGN, T_MUL_ASSIGN, T_DIV_ASSIGN,
+           T_MOD_ASSIGN, T_AND_ASSIGN, T_OR_ASSIGN, T_XOR_ASSIGN);
+    EXPECT("<< >> ++ --",
+           T_LEFT_SHIFT, T_RIGHT_SHIFT, T_INC, T_DEC);
+    EXPECT("! ~ & | ^ + - * / % = < >",
+           T_NOT, T_TILDE, T_AND, T_OR, T_XOR, T_PLUS, T_MINUS, T_STAR,
+           T_DIV, T_MOD, T_ASSIGN, T_LESS, T_GREATER);
+    EXPECT("( ) [ ] { } , : ; . ? \\",
+           T_LEFT_PAREN, T_RIGHT_PAREN, T_LEFT_BRACKET, T_RIGHT_BRACKET,
+           T_LEFT_BRACE, T_RIGHT_BRACE, T_COMMA, T_COLON, T_SEMICOLON,
+           T_DOT, T_QUESTION, T_BACKSLASH);
+
+    printf("  OK\n");
+}
+
+static void test_maximal_munch(void)
+{
+    printf("[TEST] maximal munch...\n");
+
+    EXPECT("a-->b", T_IDENTIFIER, T_DEC, T_GREATER, T_IDENTIFIER);
+    EXPECT("a--->b", T_IDENTIFIER, T_DEC, T_ARROW, T_IDENTIFIER);
+    EXPECT("a<<<=b", T_IDENTIFIER, T_LEFT_SHIFT, T_LESS_EQUAL, T_IDENTIFIER);
+    EXPECT("a>>==b", T_IDENTIFIER, T_RIGHT_SHIFT_ASSIGN, T_ASSIGN, T_IDENTIFIER);
+    EXPECT("a..b", T_IDENTIFIER, T_DOT, T_DOT, T_IDENTIFIER);
+    EXPECT("....", T_ELLIPSIS, T_DOT);
+    EXPECT("a+++b", T_IDENTIFIER, T_INC, T_PLUS, T_IDENTIFIER);
+    EXPECT("a&&=b", T_IDENTIFIER, T_AND_AND, T_ASSIGN, T_IDENTIFIER);
+    EXPECT("a / b", T_IDENTIFIER, T_DIV, T_IDENTIFIER);
+    EXPECT("a/b", T_IDENTIFIER, T_DIV, T_IDENTIFIER);
+
+    // 源码在运算符中间结束
+    EXPECT("<<", T_LEFT_SHIFT);
+    EXPECT("..", T_DOT, T_DOT);
+    EXPECT("-", T_MINUS);
+    EXPECT("/", T_DIV);
+
+    printf("  OK\n");
+}
+
+static void test_operator_text(void)
+{
+    printf("[TEST] operator text and columns...\n");
+
+    const char *src = "x <<= y->z";
+    Vector *tokens = tokenize_all(src);
+    LineIndex *li = line_index_new(src, strlen(src));
+    size_t line, col;
+
+    Token *t = vector_get(tokens, 1);
+    assert(t->len == 3 && strncmp(t->str, "<<=", 3) == 0);
+    line_index_locate(li, t->pos, &line, &col);
+    assert(line == 1 && col == 3);
+
+    t = vector_get(tokens, 3);
+    assert(t->type == T_ARROW && t->len == 2);
+    assert(t->pos == 7);
+
+    line_index_free(li);
+    vector_free(tokens);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_every_operator();
+    test_maximal_munch();
+    test_operator_text();
+    return 0;
+}
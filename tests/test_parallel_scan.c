@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "vector.h"
+#include "arena.h"
+#include "unit_scanner.h"
+#include "unit_scanner_impl/statement_unit.h"
+
+static int same_unit(StatementUnit *a, StatementUnit *b);
+
+static int same_units(Vector *a, Vector *b)
+{
+    if (!a || !b)
+        return a == b;
+    if (a->size != b->size)
+        return 0;
+    for (size_t i = 0; i < a->size; ++i)
+        if (!same_unit(*(StatementUnit **)vector_get(a, i), *(StatementUnit **)vector_get(b, i)))
+            return 0;
+    return 1;
+}
+
+// 两棵语句树的结构与 Token 区间完全相同
+static int same_unit(StatementUnit *a, StatementUnit *b)
+{
+    if (!a || !b)
+        return a == b;
+    if (a->type != b->type || a->tokens.begin != b->tokens.begin ||
+        a->tokens.end != b->tokens.end)
+        return 0;
+
+    switch (a->type)
+    {
+    case SUT_COMPOUND:
+        return same_units(a->compound_stmt.units, b->compound_stmt.units);
+    case SUT_IF:
+        return same_unit(a->if_stmt.cond, b->if_stmt.cond) &&
+               same_unit(a->if_stmt.then_body, b->if_stmt.then_body) &&
+               same_unit(a->if_stmt.else_body, b->if_stmt.else_body);
+    case SUT_SWITCH:
+        return same_unit(a->switch_stmt.expr, b->switch_stmt.expr) &&
+               same_unit(a->switch_stmt.body, b->switch_stmt.body);
+    case SUT_WHILE:
+        return same_unit(a->while_stmt.cond, b->while_stmt.cond) &&
+               same_unit(a->while_stmt.body, b->while_stmt.body);
+    case SUT_DO_WHILE:
+        return same_unit(a->do_while_stmt.body, b->do_while_stmt.body) &&
+               same_unit(a->do_while_stmt.cond, b->do_while_stmt.cond);
+    case SUT_FOR:
+        return same_unit(a->for_stmt.init, b->for_stmt.init) &&
+               same_unit(a->for_stmt.cond, b->for_stmt.cond) &&
+               same_unit(a->for_stmt.step, b->for_stmt.step) &&
+               same_unit(a->for_stmt.body, b->for_stmt.body);
+    case SUT_RETURN:
+        return same_unit(a->return_stmt.expr, b->return_stmt.expr);
+    case SUT_LABEL:
+        return strcmp(a->label_stmt.name, b->label_stmt.name) == 0;
+    default:
+        return 1;
+    }
+}
+
+static const char *clean_parts[] = {
+    "int f(int a) { if (a) { return a; } else { while (a--) ; } return 0; }\n",
+    "struct s { int x; int y[4]; };\n",
+    "void g(void) { for (;;) { switch (x) { case 1: break; default: ; } } }\n",
+    "#define M 1\n",
+    "extern int h(int, char **);\n",
+};
+
+// 会跨越切块边界的 if-else、do-while，以及让 compound 错位的初始化列表和多余的括号
+static const char *noisy_parts[] = {
+    "int f(int a) { if (a) { return a; } else { while (a--) ; } return 0; }\n",
+    "void g(void) { for (;;) { switch (x) { case 1: break; default: ; } } }\n",
+    "if (x) y = 1;\n",
+    "else y = 2;\n",
+    "do { z++; }\n",
+    "while (z < 10);\n",
+    "label: ;\n",
+    "static int table[] = { 1, 2, 3, 4 };\n",
+    "}\n",
+};
+
+static char *make_source(const char **parts, size_t count, unsigned seed, size_t pieces, int unclosed)
+{
+    srand(seed);
+    size_t cap = pieces * 80 + 4, len = 0;
+    char *src = malloc(cap);
+    for (size_t i = 0; i < pieces; ++i)
+    {
+        // 未闭合的括号让其后的内容无法再切分，只在最后一部分出现
+        if (unclosed && i == pieces - pieces / 8)
+            src[len++] = '(';
+
+        const char *part = parts[(size_t)rand() % count];
+        size_t n = strlen(part);
+        memcpy(src + len, part, n);
+        len += n;
+    }
+    src[len] = '\0';
+    return src;
+}
+
+static void check_same_tree(const char *src, size_t threads)
+{
+    Vector *tokens = tokenize_all(src);
+
+    UnitScanner *seq = unit_scanner_new(tokens);
+    StatementUnit *expect = scan_file(seq);
+
+    // 两个扫描器会各自释放 tokens，这里给并行版本一份拷贝
+    Vector *copy = vector_new(sizeof(Token));
+    vector_extend_from(copy, tokens);
+
+    UnitScanner *par = unit_scanner_new(copy);
+    StatementUnit *got = scan_file_parallel(par, threads);
+
+    assert(same_unit(expect, got));
+    assert(seq->pos == par->pos);
+
+    statement_unit_free(expect);
+    statement_unit_free(got);
+    unit_scanner_free(seq);
+    unit_scanner_free(par);
+}
+
+static void test_matches_sequential(void)
+{
+    printf("[TEST] parallel scan matches scan_file...\n");
+
+    size_t clean = sizeof(clean_parts) / sizeof(*clean_parts);
+    size_t noisy = sizeof(noisy_parts) / sizeof(*noisy_parts);
+    for (unsigned seed = 1; seed <= 4; ++seed)
+    {
+        char *src = make_source(clean_parts, clean, seed, 20000, seed % 2);
+        check_same_tree(src, 4);
+        check_same_tree(src, 0);
+        free(src);
+
+        src = make_source(noisy_parts, noisy, seed, 20000, seed % 2);
+        check_same_tree(src, 4);
+        free(src);
+    }
+
+    // 文件太小时直接退回顺序扫描
+    check_same_tree("int main(void) { return 0; }", 8);
+
+    printf("  OK\n");
+}
+
+static void test_with_arena(void)
+{
+    printf("[TEST] parallel scan inside an arena...\n");
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+
+    char *src = make_source(clean_parts, sizeof(clean_parts) / sizeof(*clean_parts), 42, 20000, 0);
+    check_same_tree(src, 3);
+    free(src);
+
+    arena_use(prev);
+    arena_free(arena);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_matches_sequential();
+    test_with_arena();
+    return 0;
+}
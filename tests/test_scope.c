@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <assert.h>
+
+#include "interner.h"
+#include "decl_parser_impl/scope.h"
+
+// 测试只关心查找逻辑，用 Symbol 数组的地址充当不同的符号
+static Symbol *fake_symbol(int i)
+{
+    static char storage[256];
+    return (Symbol *)&storage[i];
+}
+
+static void test_empty_scope_is_lazy(void)
+{
+    printf("[TEST] empty scope allocates no table...\n");
+
+    Scope *scope = scope_enter(NULL, SYM_OBJECT);
+    assert(scope->idents.count == 0 && scope->idents.map == NULL);
+    assert(scope->tags.map == NULL && scope->labels.map == NULL);
+    assert(identifier_lookup(scope, intern_id("nothing", 7)) == NULL);
+
+    scope_free(scope);
+    printf("  OK\n");
+}
+
+static void test_inline_then_promote(void)
+{
+    printf("[TEST] inline table promotes to hash map...\n");
+
+    Scope *scope = scope_enter(NULL, SYM_OBJECT);
+    char name[16];
+    uint32_t ids[64];
+
+    for (int i = 0; i < 64; ++i)
+    {
+        int n = snprintf(name, sizeof(name), "v%d", i);
+        ids[i] = intern_id(name, (size_t)n);
+        assert(identifier_insert(scope, ids[i], fake_symbol(i)) == fake_symbol(i));
+
+        // 内联容量以内不分配 HashMap
+        if (i < SCOPE_TABLE_INLINE)
+            assert(scope->idents.map == NULL);
+        else
+            assert(scope->idents.map != NULL);
+
+        // 提升前后登记过的符号都能找到
+        for (int j = 0; j <= i; ++j)
+            assert(identifier_lookup(scope, ids[j]) == fake_symbol(j));
+    }
+
+    // 重复登记返回已有的符号
+    assert(identifier_insert(scope, ids[0], fake_symbol(100)) == fake_symbol(0));
+    assert(identifier_insert(scope, ids[63], fake_symbol(100)) == fake_symbol(63));
+
+    scope_free(scope);
+    printf("  OK\n");
+}
+
+static void test_namespaces_and_shadowing(void)
+{
+    printf("[TEST] separate namespaces and shadowing...\n");
+
+    uint32_t node = intern_id("node", 4);
+
+    Scope *file = scope_enter(NULL, SYM_OBJECT);
+    Scope *block = scope_enter(file, SYM_OBJECT);
+
+    tag_insert(file, node, fake_symbol(1));        // struct node
+    identifier_insert(file, node, fake_symbol(2)); // node 变量
+    label_insert(block, node, fake_symbol(3));     // node:
+
+    assert(tag_lookup(block, node) == fake_symbol(1));
+    assert(identifier_lookup(block, node) == fake_symbol(2));
+    assert(label_lookup(block, node) == fake_symbol(3));
+    assert(label_lookup(file, node) == NULL);
+
+    // 内层同名变量遮蔽外层
+    identifier_insert(block, node, fake_symbol(4));
+    assert(identifier_lookup(block, node) == fake_symbol(4));
+    assert(identifier_lookup(file, node) == fake_symbol(2));
+
+    scope_free(block);
+    scope_free(file);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_empty_scope_is_lazy();
+    test_inline_then_promote();
+    test_namespaces_and_shadowing();
+    intern_clear();
+    return 0;
+}
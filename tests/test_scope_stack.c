@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "interner.h"
+#include "decl_parser_impl/scope.h"
+#include "decl_parser_impl/scope_impl/scope_stack.h"
+
+static Symbol *fake_symbol(int i)
+{
+    static char storage[4096];
+    return (Symbol *)&storage[i];
+}
+
+static void test_shadow_and_restore(void)
+{
+    printf("[TEST] shadowing restored on leave...\n");
+
+    uint32_t x = intern_id("x", 1), y = intern_id("y", 1);
+    ScopeStack *ss = scope_stack_new();
+
+    assert(scope_stack_bind(ss, SNS_IDENT, x, fake_symbol(1)) == fake_symbol(1));
+    assert(scope_stack_depth(ss) == 0);
+
+    scope_stack_enter(ss);
+    assert(scope_stack_bind(ss, SNS_IDENT, x, fake_symbol(2)) == fake_symbol(2));
+    assert(scope_stack_bind(ss, SNS_IDENT, y, fake_symbol(3)) == fake_symbol(3));
+    // 同一层重复声明不覆盖
+    assert(scope_stack_bind(ss, SNS_IDENT, x, fake_symbol(9)) == fake_symbol(2));
+
+    scope_stack_enter(ss);
+    scope_stack_bind(ss, SNS_IDENT, x, fake_symbol(4));
+    assert(scope_stack_lookup(ss, SNS_IDENT, x) == fake_symbol(4));
+    assert(scope_stack_lookup(ss, SNS_IDENT, y) == fake_symbol(3));
+    scope_stack_leave(ss);
+
+    assert(scope_stack_lookup(ss, SNS_IDENT, x) == fake_symbol(2));
+    scope_stack_leave(ss);
+
+    assert(scope_stack_depth(ss) == 0);
+    assert(scope_stack_lookup(ss, SNS_IDENT, x) == fake_symbol(1));
+    assert(scope_stack_lookup(ss, SNS_IDENT, y) == NULL);
+
+    // 名字空间互不干扰
+    assert(scope_stack_lookup(ss, SNS_TAG, x) == NULL);
+    scope_stack_bind(ss, SNS_TAG, x, fake_symbol(5));
+    assert(scope_stack_lookup(ss, SNS_TAG, x) == fake_symbol(5));
+    assert(scope_stack_lookup(ss, SNS_IDENT, x) == fake_symbol(1));
+
+    // 多余的 leave 不会出错
+    scope_stack_leave(ss);
+
+    scope_stack_free(ss);
+    printf("  OK\n");
+}
+
+// 与 Scope 链做随机对照：同样的操作序列下查找结果必须一致
+static void test_matches_scope_chain(void)
+{
+    printf("[TEST] random ops match Scope chain...\n");
+
+    enum { NAMES = 40, OPS = 20000 };
+    uint32_t ids[NAMES];
+    char name[16];
+    for (int i = 0; i < NAMES; ++i)
+    {
+        int n = snprintf(name, sizeof(name), "n%d", i);
+        ids[i] = intern_id(name, (size_t)n);
+    }
+
+    ScopeStack *ss = scope_stack_new();
+    Scope *chain = scope_enter(NULL, SYM_OBJECT);
+
+    srand(7);
+    for (int op = 0; op < OPS; ++op)
+    {
+        int r = rand() % 10;
+        uint32_t id = ids[rand() % NAMES];
+
+        if (r < 2)
+        {
+            scope_stack_enter(ss);
+            chain = scope_enter(chain, SYM_OBJECT);
+        }
+        else if (r < 4 && chain->parent)
+        {
+            scope_stack_leave(ss);
+            Scope *parent = chain->parent;
+            scope_free(chain);
+            chain = parent;
+        }
+        else if (r < 6)
+        {
+            Symbol *s = fake_symbol(op % 4096);
+            assert(scope_stack_bind(ss, SNS_IDENT, id, s) == identifier_insert(chain, id, s));
+        }
+
+        assert(scope_stack_lookup(ss, SNS_IDENT, id) == identifier_lookup(chain, id));
+    }
+
+    while (chain)
+    {
+        Scope *parent = chain->parent;
+        scope_free(chain);
+        chain = parent;
+    }
+    scope_stack_free(ss);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_shadow_and_restore();
+    test_matches_scope_chain();
+    intern_clear();
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "tokenizer_impl/tokenizer_impl.h"
+#include "tokenizer_impl/line_index.h"
+#include "vector.h"
+
+static void test_kernels_match_scalar(void)
+{
+    printf("[TEST] scan kernels match scalar...\n");
+
+    static const char alphabet[] = "  \t\t\n\r/*x;";
+    char buf[300];
+
+    srand(12345);
+    for (int round = 0; round < 2000; ++round)
+    {
+        size_t n = (size_t)(rand() % (int)sizeof(buf));
+        // 前面大段空白，让 SIMD 路径跑满若干个块
+        size_t blank = n ? (size_t)(rand() % (int)n) : 0;
+        for (size_t i = 0; i < n; ++i)
+            buf[i] = i < blank ? alphabet[rand() % 5] : alphabet[rand() % (sizeof(alphabet) - 1)];
+
+        // 从不同的偏移开始，覆盖未对齐的读取
+        size_t off = n ? (size_t)(rand() % 17) % (n + 1) : 0;
+        assert(span_blank(buf + off, n - off) == span_blank_scalar(buf + off, n - off));
+        assert(count_newlines(buf + off, n - off) == count_newlines_scalar(buf + off, n - off));
+    }
+
+    printf("  OK\n");
+}
+
+// 断言 Token 位于 line:col
+static void expect_at(const LineIndex *li, const Token *t, size_t line, size_t col)
+{
+    size_t l, c;
+    line_index_locate(li, t->pos, &l, &c);
+    assert(l == line && c == col);
+}
+
+static void test_comments(void)
+{
+    printf("[TEST] comments and positions...\n");
+
+    const char *src =
+        "/* header\n"
+        " * more\n"
+        " */a // tail\n"
+        "\t  b/**/c\r\n"
+        "//\n"
+        "d /* unterminated";
+
+    Vector *tokens = tokenize_all(src);
+    LineIndex *li = line_index_new(src, strlen(src));
+    assert(tokens->size == 5);
+
+    Token *t = vector_get(tokens, 0);
+    assert(t->len == 1 && t->str[0] == 'a');
+    expect_at(li, t, 3, 4);
+
+    t = vector_get(tokens, 1);
+    assert(t->str[0] == 'b');
+    expect_at(li, t, 4, 4);
+
+    t = vector_get(tokens, 2);
+    assert(t->str[0] == 'c');
+    expect_at(li, t, 4, 9);
+
+    t = vector_get(tokens, 3);
+    assert(t->str[0] == 'd');
+    expect_at(li, t, 6, 1);
+
+    assert(((Token *)vector_get(tokens, 4))->type == T_EOF);
+
+    line_index_free(li);
+    vector_free(tokens);
+    printf("  OK\n");
+}
+
+static void test_long_blank_runs(void)
+{
+    printf("[TEST] long blank runs...\n");
+
+    // 超过一个 AVX2 块的缩进和空行
+    char src[256];
+    size_t n = 0;
+    for (int i = 0; i < 70; ++i)
+        src[n++] = ' ';
+    for (int i = 0; i < 40; ++i)
+        src[n++] = '\n';
+    for (int i = 0; i < 37; ++i)
+        src[n++] = '\t';
+    src[n++] = 'x';
+    src[n] = '\0';
+
+    Vector *tokens = tokenize_all(src);
+    LineIndex *li = line_index_new(src, n);
+    Token *t = vector_get(tokens, 0);
+    assert(t->type == T_IDENTIFIER);
+    expect_at(li, t, 41, 38);
+
+    line_index_free(li);
+    vector_free(tokens);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_kernels_match_scalar();
+    test_comments();
+    test_long_blank_runs();
+    return 0;
+}
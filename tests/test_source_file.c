@@ -0,0 +1,156 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/wait.h>
+
+#include "source_file.h"
+#include "tokenizer.h"
+#include "vector.h"
+
+static char tmp_path[] = "/tmp/ccd_source_XXXXXX";
+
+static void write_tmp(const char *text, size_t len)
+{
+    int fd = mkstemp(tmp_path);
+    assert(fd >= 0);
+    assert(write(fd, text, len) == (ssize_t)len);
+    close(fd);
+}
+
+static void test_mapped_file(void)
+{
+    printf("[TEST] mmap regular file...\n");
+
+    // 故意不以换行或 '\0' 结尾，Token 必须由长度定界
+    const char text[] = "int main() { return 0; }";
+    write_tmp(text, sizeof(text) - 1);
+
+    SourceFile *sf = source_file_open(tmp_path);
+    assert(sf && sf->mapped);
+    assert(sf->len == sizeof(text) - 1);
+    assert(memcmp(sf->data, text, sf->len) == 0);
+
+    Vector *tokens = tokenize_all_n(sf->data, sf->len);
+    assert(tokens->size == 10);
+    Token *last = vector_get(tokens, 8);
+    assert(last->type == T_RIGHT_BRACE && last->pos == sf->len - 1);
+
+    vector_free(tokens);
+    source_file_close(sf);
+    unlink(tmp_path);
+
+    printf("  OK\n");
+}
+
+static void test_pipe_fallback(void)
+{
+    printf("[TEST] pipe falls back to read...\n");
+
+    int fds[2];
+    assert(pipe(fds) == 0);
+    const char text[] = "a + b;";
+    assert(write(fds[1], text, sizeof(text) - 1) == (ssize_t)(sizeof(text) - 1));
+    close(fds[1]);
+
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fds[0]);
+    SourceFile *sf = source_file_open(path);
+    if (sf) // 没有 /proc 的系统上跳过
+    {
+        assert(!sf->mapped);
+        assert(sf->len == sizeof(text) - 1);
+        assert(memcmp(sf->data, text, sf->len) == 0);
+        source_file_close(sf);
+    }
+    close(fds[0]);
+
+    printf("  OK\n");
+}
+
+static void on_signal(int sig) { (void)sig; }
+
+static void test_read_interrupted(void)
+{
+    printf("[TEST] read retries after a signal...\n");
+
+    // 不带 SA_RESTART，阻塞中的 read 被信号打断时返回 EINTR
+    struct sigaction sa, old;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigemptyset(&sa.sa_mask);
+    assert(sigaction(SIGUSR1, &sa, &old) == 0);
+
+    int fds[2];
+    assert(pipe(fds) == 0);
+    const char text[] = "x = 1;";
+
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0)
+    {
+        // 子进程：等父进程阻塞在 read 上，先发信号，再写入数据
+        struct timespec ts = {0, 50 * 1000 * 1000};
+        close(fds[0]);
+        nanosleep(&ts, NULL);
+        kill(getppid(), SIGUSR1);
+        nanosleep(&ts, NULL);
+        if (write(fds[1], text, sizeof(text) - 1) != (ssize_t)(sizeof(text) - 1))
+            _exit(1);
+        _exit(0);
+    }
+    close(fds[1]);
+
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fds[0]);
+    SourceFile *sf = source_file_open(path);
+    assert(sf || access("/proc/self/fd", F_OK) != 0); // 没有 /proc 的系统上跳过
+    if (sf)
+    {
+        assert(sf->len == sizeof(text) - 1);
+        assert(memcmp(sf->data, text, sf->len) == 0);
+        source_file_close(sf);
+    }
+    close(fds[0]);
+
+    int status;
+    assert(waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    sigaction(SIGUSR1, &old, NULL);
+
+    printf("  OK\n");
+}
+
+static void test_empty_and_missing(void)
+{
+    printf("[TEST] empty and missing files...\n");
+
+    strcpy(tmp_path, "/tmp/ccd_source_XXXXXX");
+    write_tmp("", 0);
+
+    SourceFile *sf = source_file_open(tmp_path);
+    assert(sf && sf->len == 0);
+    Vector *tokens = tokenize_all_n(sf->data, sf->len);
+    assert(tokens->size == 1);
+    assert(((Token *)vector_get(tokens, 0))->type == T_EOF);
+    vector_free(tokens);
+    source_file_close(sf);
+    unlink(tmp_path);
+
+    assert(source_file_open("/nonexistent/ccd/file.c") == NULL);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_mapped_file();
+    test_pipe_fallback();
+    test_read_interrupted();
+    test_empty_and_missing();
+    return 0;
+}
@@ -24,8 +24,8 @@ TokenStream init_stream(const char *src)
 
     while (1)
     {
-        Token *t = next(tk);
-        vector_push_back(vec, t);
+        Token *t = vector_emplace_back(vec);
+        next_into(tk, t);
         if (t->type == T_EOF)
             break;
     }
@@ -34,7 +34,7 @@ TokenStream init_stream(const char *src)
     return (TokenStream){vec, 0};
 }
 
-Vector *slice_until(TokenStream *ts, TokenType type)
+TokenRange slice_until(TokenStream *ts, TokenType type)
 {
     size_t start = ts->cursor;
     size_t end = start;
@@ -52,19 +52,19 @@ Vector *slice_until(TokenStream *ts, TokenType type)
         end++;
     }
 
-    Vector *sub = vector_slice(ts->all_tokens, start, end + 1);
+    TokenRange sub = make_token_range(ts->all_tokens, start, end + 1);
     ts->cursor = end + 1;
     return sub;
 }
 
-Vector *slice_exact(TokenStream *ts, size_t n)
+TokenRange slice_exact(TokenStream *ts, size_t n)
 {
     if (ts->cursor + n > ts->all_tokens->size)
     {
         fprintf(stderr, "slice_exact: OOB\n");
         exit(1);
     }
-    Vector *sub = vector_slice(ts->all_tokens, ts->cursor, ts->cursor + n);
+    TokenRange sub = make_token_range(ts->all_tokens, ts->cursor, ts->cursor + n);
     ts->cursor += n;
     return sub;
 }
@@ -97,14 +97,14 @@ void test_full()
     TokenStream ts = init_stream(src);
 
     // root {
-    Vector *root_tok = slice_exact(&ts, 1);
+    TokenRange root_tok = slice_exact(&ts, 1);
     Vector *root_children = vector_new(sizeof(StatementUnit *));
 
     // -------------------------
     // declaration: int a = 1;
     // -------------------------
     {
-        Vector *toks = slice_until(&ts, T_SEMICOLON);
+        TokenRange toks = slice_until(&ts, T_SEMICOLON);
         StatementUnit *u = make_decl_or_expr_statement_unit(toks);
         vector_push_back(root_children, &u);
     }
@@ -113,7 +113,7 @@ void test_full()
     // expression: a++;
     // -------------------------
     {
-        Vector *toks = slice_until(&ts, T_SEMICOLON);
+        TokenRange toks = slice_until(&ts, T_SEMICOLON);
         StatementUnit *u = make_decl_or_expr_statement_unit(toks);
         vector_push_back(root_children, &u);
     }
@@ -122,44 +122,42 @@ void test_full()
     // if (...) { ... } else { ... }
     // -------------------------
     {
-        Vector *if_kw = slice_exact(&ts, 1); // if
+        TokenRange if_kw = slice_exact(&ts, 1); // if
 
-        Vector *cond = slice_until(&ts, T_RIGHT_PAREN); // (a)
+        TokenRange cond = slice_until(&ts, T_RIGHT_PAREN); // (a)
         StatementUnit *cond_u = make_decl_or_expr_statement_unit(cond);
 
         // then { return a; }
-        Vector *then_l = slice_exact(&ts, 1); // {
+        TokenRange then_l = slice_exact(&ts, 1); // {
         Vector *then_children = vector_new(sizeof(StatementUnit *));
         {
-            Vector *ret_kw = slice_exact(&ts, 1);             // return
-            Vector *ret_expr = slice_until(&ts, T_SEMICOLON); // a;
+            TokenRange ret_kw = slice_exact(&ts, 1);             // return
+            TokenRange ret_expr = slice_until(&ts, T_SEMICOLON); // a;
             StatementUnit *ret_u = make_return_statement_unit(
                 ret_kw,
                 make_decl_or_expr_statement_unit(ret_expr));
             vector_push_back(then_children, &ret_u);
         }
-        Vector *then_r = slice_exact(&ts, 1); // }
+        TokenRange then_r = slice_exact(&ts, 1); // }
 
-        vector_push_back(then_l, vector_get(then_r, 0));
-        vector_free(then_r);
+        then_l = make_token_range(ts.all_tokens, then_l.begin, then_r.end);
 
         StatementUnit *then_u = make_compound_statement_unit(then_l, then_children);
 
         // else { goto label; }
-        Vector *else_kw = slice_exact(&ts, 1); // else
+        TokenRange else_kw = slice_exact(&ts, 1); // else
         (void)else_kw;
 
-        Vector *else_l = slice_exact(&ts, 1); // {
+        TokenRange else_l = slice_exact(&ts, 1); // {
         Vector *else_children = vector_new(sizeof(StatementUnit *));
         {
-            Vector *goto_toks = slice_until(&ts, T_SEMICOLON); // goto label;
+            TokenRange goto_toks = slice_until(&ts, T_SEMICOLON); // goto label;
             StatementUnit *g = make_goto_statement_unit(goto_toks, "label");
             vector_push_back(else_children, &g);
         }
-        Vector *else_r = slice_exact(&ts, 1); // }
+        TokenRange else_r = slice_exact(&ts, 1); // }
 
-        vector_push_back(else_l, vector_get(else_r, 0));
-        vector_free(else_r);
+        else_l = make_token_range(ts.all_tokens, else_l.begin, else_r.end);
 
         StatementUnit *else_u = make_compound_statement_unit(else_l, else_children);
 
@@ -171,7 +169,7 @@ void test_full()
     // while(1) continue;
     // -------------------------
     {
-        Vector *w_kw = slice_exact(&ts, 1); // while
+        TokenRange w_kw = slice_exact(&ts, 1); // while
         StatementUnit *cond = make_decl_or_expr_statement_unit(slice_until(&ts, T_RIGHT_PAREN));
         StatementUnit *body = make_continue_statement_unit(slice_until(&ts, T_SEMICOLON));
         StatementUnit *u = make_while_statement_unit(w_kw, cond, body);
@@ -182,26 +180,25 @@ void test_full()
     // do { break; } while(0);
     // -------------------------
     {
-        Vector *do_kw = slice_exact(&ts, 1); // do
+        TokenRange do_kw = slice_exact(&ts, 1); // do
 
-        Vector *body_l = slice_exact(&ts, 1);
+        TokenRange body_l = slice_exact(&ts, 1);
         Vector *body_children = vector_new(sizeof(StatementUnit *));
         {
-            Vector *bk = slice_until(&ts, T_SEMICOLON);
+            TokenRange bk = slice_until(&ts, T_SEMICOLON);
             StatementUnit *bku = make_break_statement_unit(bk);
             vector_push_back(body_children, &bku);
         }
-        Vector *body_r = slice_exact(&ts, 1);
+        TokenRange body_r = slice_exact(&ts, 1);
 
-        vector_push_back(body_l, vector_get(body_r, 0));
-        vector_free(body_r);
+        body_l = make_token_range(ts.all_tokens, body_l.begin, body_r.end);
 
         StatementUnit *body_u = make_compound_statement_unit(body_l, body_children);
 
-        Vector *while_kw = slice_exact(&ts, 1);
+        TokenRange while_kw = slice_exact(&ts, 1);
         (void)while_kw; // while
         StatementUnit *cond = make_decl_or_expr_statement_unit(slice_until(&ts, T_RIGHT_PAREN));
-        Vector *semi = slice_exact(&ts, 1);
+        TokenRange semi = slice_exact(&ts, 1);
         (void)semi;
 
         StatementUnit *u = make_do_while_statement_unit(do_kw, body_u, cond);
@@ -212,15 +209,15 @@ void test_full()
     // for(;;);
     // -------------------------
     {
-        Vector *for_kw = slice_exact(&ts, 1); // for
-        Vector *lp = slice_exact(&ts, 1);
+        TokenRange for_kw = slice_exact(&ts, 1); // for
+        TokenRange lp = slice_exact(&ts, 1);
         (void)lp; // (
 
         StatementUnit *init = make_empty_statement_unit(slice_exact(&ts, 1)); // ;
         StatementUnit *cond = make_empty_statement_unit(slice_exact(&ts, 1)); // ;
         StatementUnit *step = NULL;
 
-        Vector *rp = slice_exact(&ts, 1);
+        TokenRange rp = slice_exact(&ts, 1);
         (void)rp; // )
 
         StatementUnit *body = make_empty_statement_unit(slice_exact(&ts, 1));
@@ -233,28 +230,28 @@ void test_full()
     // switch (a) { case 1: a=2; default: ; }
     // -------------------------
     {
-        Vector *sw_kw = slice_exact(&ts, 1); // switch
+        TokenRange sw_kw = slice_exact(&ts, 1); // switch
         StatementUnit *expr = make_decl_or_expr_statement_unit(slice_until(&ts, T_RIGHT_PAREN));
 
-        Vector *body_l = slice_exact(&ts, 1);
+        TokenRange body_l = slice_exact(&ts, 1);
         Vector *children = vector_new(sizeof(StatementUnit *));
 
         // case 1:
-        Vector *case_kw = slice_exact(&ts, 1);
+        TokenRange case_kw = slice_exact(&ts, 1);
         StatementUnit *cv = make_decl_or_expr_statement_unit(slice_until(&ts, T_COLON));
         StatementUnit *cu = make_case_statement_unit(case_kw, cv);
         vector_push_back(children, &cu);
 
         // a=2;
         {
-            Vector *toks = slice_until(&ts, T_SEMICOLON);
+            TokenRange toks = slice_until(&ts, T_SEMICOLON);
             StatementUnit *e = make_decl_or_expr_statement_unit(toks);
             vector_push_back(children, &e);
         }
 
         // default:
         {
-            Vector *def_toks = slice_until(&ts, T_COLON);
+            TokenRange def_toks = slice_until(&ts, T_COLON);
             StatementUnit *d = make_default_statement_unit(def_toks, 0);
             vector_push_back(children, &d);
         }
@@ -264,9 +261,8 @@ void test_full()
             vector_push_back(children, &e);
         }
 
-        Vector *body_r = slice_exact(&ts, 1);
-        vector_push_back(body_l, vector_get(body_r, 0));
-        vector_free(body_r);
+        TokenRange body_r = slice_exact(&ts, 1);
+        body_l = make_token_range(ts.all_tokens, body_l.begin, body_r.end);
 
         StatementUnit *body = make_compound_statement_unit(body_l, children);
 
@@ -278,7 +274,7 @@ void test_full()
     // label: ;
     // -------------------------
     {
-        Vector *label_toks = slice_until(&ts, T_COLON);
+        TokenRange label_toks = slice_until(&ts, T_COLON);
         StatementUnit *lu = make_label_statement_unit(label_toks, "label");
         vector_push_back(root_children, &lu);
 
@@ -289,9 +285,8 @@ void test_full()
     // -------------------------
     // root }
     // -------------------------
-    Vector *root_end = slice_exact(&ts, 1);
-    vector_push_back(root_tok, vector_get(root_end, 0));
-    vector_free(root_end);
+    TokenRange root_end = slice_exact(&ts, 1);
+    root_tok = make_token_range(ts.all_tokens, root_tok.begin, root_end.end);
 
     // 构建根节点
     StatementUnit *root = make_compound_statement_unit(root_tok, root_children);
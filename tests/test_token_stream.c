@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "tokenizer_impl/token_stream.h"
+#include "unit_scanner.h"
+#include "vector.h"
+
+static const char *src =
+    "#include <stdio.h>\n"
+    "int main(void) {\n"
+    "    char c = 'x'; const char *s = \"hi\";\n"
+    "    for (int i = 0; i < 10; ++i) c += i;\n"
+    "    return c >> 1;\n"
+    "}\n";
+
+static void test_round_trip(void)
+{
+    printf("[TEST] token stream round trip...\n");
+
+    Vector *tokens = tokenize_all(src);
+    TokenStream *ts = token_stream_new(tokens);
+    assert(ts && ts->size == tokens->size);
+    assert(ts->src == src);
+
+    for (size_t i = 0; i < tokens->size; ++i)
+    {
+        Token *a = vector_get(tokens, i);
+        Token b;
+        assert(token_stream_get(ts, i, &b));
+
+        assert(token_stream_kind(ts, i) == a->type);
+        assert(b.type == a->type && b.pos == a->pos && b.len == a->len);
+        if (a->len)
+            assert(b.str == a->str);
+    }
+
+    // 越界访问
+    Token dummy;
+    assert(token_stream_kind(ts, ts->size) == T_EOF);
+    assert(!token_stream_get(ts, ts->size, &dummy));
+
+    token_stream_free(ts);
+    vector_free(tokens);
+
+    printf("  OK\n");
+}
+
+static void test_scanner_kinds(void)
+{
+    printf("[TEST] scanner peek_kind...\n");
+
+    Vector *tokens = tokenize_all("x = 1;");
+    UnitScanner *us = unit_scanner_new(tokens);
+
+    assert(peek_kind(us) == T_IDENTIFIER);
+    assert(peek_kind_at(us, 1) == T_ASSIGN);
+    assert(peek_kind_at(us, 3) == T_SEMICOLON);
+    assert(peek_kind_at(us, 4) == T_EOF);
+    assert(peek_kind_at(us, 100) == T_EOF);
+
+    next_token(us);
+    assert(peek_kind(us) == T_ASSIGN);
+    assert(peek_kind(us) == peek_token(us)->type);
+
+    unit_scanner_free(us);
+
+    printf("  OK\n");
+}
+
+// 与按类型分别计数深度的朴素做法对照
+static size_t naive_match(Vector *tokens, size_t i)
+{
+    TokenType open = ((Token *)vector_get(tokens, i))->type, close;
+    switch (open)
+    {
+    case T_LEFT_PAREN:
+        close = T_RIGHT_PAREN;
+        break;
+    case T_LEFT_BRACKET:
+        close = T_RIGHT_BRACKET;
+        break;
+    case T_LEFT_BRACE:
+        close = T_RIGHT_BRACE;
+        break;
+    default:
+        return i;
+    }
+
+    size_t depth = 0;
+    for (size_t j = i + 1; j < tokens->size; ++j)
+    {
+        TokenType t = ((Token *)vector_get(tokens, j))->type;
+        if (t == open)
+            depth++;
+        else if (t == close && depth-- == 0)
+            return j;
+    }
+    return tokens->size - 1; // EOF
+}
+
+static void test_bracket_match(void)
+{
+    printf("[TEST] bracket match table...\n");
+
+    const char *cases[] = {
+        src,
+        "f(a[1], (b)) { { } }",
+        "( [ ) ] { ( } )",  // 各类括号独立配对
+        "( ( ) { [ ] ] ) }", // 多余的右括号与缺失的右括号
+        "",
+    };
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(*cases); ++c)
+    {
+        Vector *tokens = tokenize_all(cases[c]);
+        TokenStream *ts = token_stream_new(tokens);
+
+        for (size_t i = 0; i < ts->size; ++i)
+        {
+            size_t m = token_stream_match(ts, i);
+            TokenType t = token_stream_kind(ts, i);
+            if (t == T_LEFT_PAREN || t == T_LEFT_BRACKET || t == T_LEFT_BRACE)
+            {
+                assert(m == naive_match(tokens, i));
+                if (token_stream_kind(ts, m) != T_EOF)
+                    assert(token_stream_match(ts, m) == i);
+            }
+            else if (m != i)
+                assert(m < i && token_stream_match(ts, m) == i);
+        }
+        assert(token_stream_match(ts, ts->size + 3) == ts->size + 3);
+
+        token_stream_free(ts);
+        vector_free(tokens);
+    }
+
+    printf("  OK\n");
+}
+
+static void test_oversized(void)
+{
+    printf("[TEST] token stream rejects offsets beyond 32 bits...\n");
+
+    // 只伪造 pos / len，不需要真的有 4 GiB 的源码
+    Vector *tokens = tokenize_all("a b");
+    Token *t = vector_get(tokens, 1);
+    t->pos = UINT32_MAX - 1;
+    t->len = 1;
+    TokenStream *ts = token_stream_new(tokens);
+    assert(ts);
+    token_stream_free(ts);
+
+    t->len = 2;
+    assert(!token_stream_new(tokens));
+    t->pos = (size_t)UINT32_MAX + 1;
+    t->len = 0;
+    assert(!token_stream_new(tokens));
+
+    // 扫描器拿不到 Token 流时失败，tokens 仍由调用者释放
+    assert(!unit_scanner_new(tokens));
+    vector_free(tokens);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_round_trip();
+    test_scanner_kinds();
+    test_bracket_match();
+    test_oversized();
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "tokenizer.h"
@@ -53,8 +54,120 @@ void test_auto_scan()
     printf("=== Auto Scan OK ===\n");
 }
 
+// 嵌套的语句单元都指向同一个 Token 数组，区间逐层包含
+void test_shared_ranges()
+{
+    printf("[TEST] units share the scanner tokens...\n");
+
+    Vector *tokens = tokenize_all("void f() { if (a) { while (b) { c = 1; } } }");
+    UnitScanner *us = unit_scanner_new(tokens);
+    StatementUnit *root = scan_file(us);
+
+    assert(root->tokens.vec == tokens);
+    assert(root->tokens.begin == 0 && root->tokens.end == tokens->size);
+
+    // void f() / { ... }
+    StatementUnit *body = *(StatementUnit **)vector_get(root->compound_stmt.units, 1);
+    StatementUnit *if_u = *(StatementUnit **)vector_get(body->compound_stmt.units, 0);
+    StatementUnit *while_u = *(StatementUnit **)vector_get(if_u->if_stmt.then_body->compound_stmt.units, 0);
+    StatementUnit *stmts[] = {body, if_u, while_u, while_u->while_stmt.cond};
+
+    for (size_t i = 0; i < sizeof(stmts) / sizeof(*stmts); ++i)
+    {
+        assert(stmts[i]->tokens.vec == tokens);
+        if (i)
+            assert(stmts[i - 1]->tokens.begin <= stmts[i]->tokens.begin &&
+                   stmts[i]->tokens.end <= stmts[i - 1]->tokens.end);
+    }
+
+    // 视图中的 Token 就是原数组中的 Token
+    assert(token_range_get(if_u->tokens, 0) == vector_get(tokens, if_u->tokens.begin));
+    assert(token_range_get(if_u->tokens, 0)->type == T_IF);
+    assert(token_range_get(while_u->while_stmt.cond->tokens, 0)->len == 1);
+    assert(token_range_get(if_u->tokens, token_range_size(if_u->tokens)) == NULL);
+
+    statement_unit_free(root);
+    unit_scanner_free(us);
+    printf("  OK\n");
+}
+
+// 足以让递归实现耗尽默认 8 MiB 调用栈的嵌套深度
+#define DEEP_NESTING 200000
+
+void test_deep_nesting()
+{
+    printf("[TEST] deep nesting does not overflow the stack...\n");
+
+    // { if (a) { if (a) ... ; } ... }
+    const char *open = "{ if (a) ";
+    size_t n = DEEP_NESTING, open_len = strlen(open);
+    char *src = malloc(n * (open_len + 2) + 2);
+    char *p = src;
+    for (size_t i = 0; i < n; ++i, p += open_len)
+        memcpy(p, open, open_len);
+    *p++ = ';';
+    for (size_t i = 0; i < n; ++i)
+        *p++ = '}';
+    *p = '\0';
+
+    Vector *tokens = tokenize_all(src);
+    UnitScanner *us = unit_scanner_new(tokens);
+    StatementUnit *root = scan_file(us);
+    assert(root && root->compound_stmt.units->size == 1);
+
+    // 逐层向下，每层都是 compound -> if -> then
+    StatementUnit *u = *(StatementUnit **)vector_get(root->compound_stmt.units, 0);
+    for (size_t depth = 0; depth < n; ++depth)
+    {
+        assert(u->type == SUT_COMPOUND && u->compound_stmt.units->size == 1);
+        StatementUnit *if_u = *(StatementUnit **)vector_get(u->compound_stmt.units, 0);
+        assert(if_u->type == SUT_IF && if_u->if_stmt.cond);
+        u = if_u->if_stmt.then_body;
+    }
+    assert(u->type == SUT_EMPTY);
+
+    statement_unit_free(root);
+    unit_scanner_free(us);
+    free(src);
+    printf("  OK\n");
+}
+
+void test_long_else_if_chain()
+{
+    printf("[TEST] long else-if chain...\n");
+
+    const char *link = "if (a) b; else ";
+    size_t n = DEEP_NESTING, link_len = strlen(link);
+    char *src = malloc(n * link_len + 3);
+    for (size_t i = 0; i < n; ++i)
+        memcpy(src + i * link_len, link, link_len);
+    strcpy(src + n * link_len, "c;");
+
+    Vector *tokens = tokenize_all(src);
+    UnitScanner *us = unit_scanner_new(tokens);
+    StatementUnit *root = scan_file(us);
+
+    StatementUnit *u = *(StatementUnit **)vector_get(root->compound_stmt.units, 0);
+    size_t count = 0;
+    while (u->type == SUT_IF)
+    {
+        assert(u->if_stmt.then_body->type == SUT_DECL_OR_EXPR);
+        u = u->if_stmt.else_body;
+        count++;
+    }
+    assert(count == n && u->type == SUT_DECL_OR_EXPR);
+
+    statement_unit_free(root);
+    unit_scanner_free(us);
+    free(src);
+    printf("  OK\n");
+}
+
 int main(void)
 {
     test_auto_scan();
+    test_shared_ranges();
+    test_deep_nesting();
+    test_long_else_if_chain();
     return 0;
 }
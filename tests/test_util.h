@@ -0,0 +1,40 @@
+#pragma once
+
+// 多个测试共用的辅助函数，只由 tests/ 下的 .c 包含
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "vector.h"
+#include "tokenizer_impl/token_stream.h"
+#include "fingerprint_impl/normalize.h"
+
+// 把一段源码归一化到已有的 ns 中，原有内容被覆盖
+static inline void normalize_into(NormStream *ns, const char *src)
+{
+    Vector *tokens = tokenize_all(src);
+    TokenStream *ts = token_stream_new(tokens);
+    assert(normalize_tokens(ns, ts));
+    token_stream_free(ts);
+    vector_free(tokens);
+}
+
+// 把一段源码归一化到新的 NormStream 中，由调用者 norm_stream_free
+static inline NormStream *normalize_src(const char *src)
+{
+    NormStream *ns = norm_stream_new();
+    assert(ns);
+    normalize_into(ns, src);
+    return ns;
+}
+
+// rand() 只保证 15 位，拼四次得到 64 位的随机哈希；结果由 srand 决定，可以复现
+static inline uint64_t rand64(void)
+{
+    uint64_t x = 0;
+    for (int i = 0; i < 4; ++i)
+        x = x << 16 ^ (uint64_t)(rand() & 0xFFFF);
+    return x;
+}
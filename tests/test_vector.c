@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <assert.h>
+
+#include "arena.h"
+#include "vector.h"
+
+typedef struct
+{
+    int a;
+    double b;
+} Pair;
+
+VEC_DEFINE(pair_vec, Pair)
+
+static void test_small_inline_then_spill(void)
+{
+    printf("[TEST] small vector inline then spill...\n");
+
+    Vector *vec = vector_new_small(sizeof(int), 4);
+    assert(vec && vec->capacity == 4);
+    void *inline_data = vec->data;
+    // 内联存储与结构体在同一块内存里
+    assert((char *)inline_data == (char *)(vec + 1));
+
+    for (int i = 0; i < 4; ++i)
+        assert(vector_push_back(vec, &i));
+    assert(vec->data == inline_data);
+
+    // 第 5 个元素溢出到堆上，原有元素保持不变
+    for (int i = 4; i < 100; ++i)
+        assert(vector_push_back(vec, &i));
+    assert(vec->data != inline_data);
+    assert(vec->size == 100);
+    for (int i = 0; i < 100; ++i)
+        assert(*(int *)vector_get(vec, i) == i);
+
+    int x = -1;
+    assert(vector_insert(vec, 0, &x));
+    assert(*(int *)vector_front(vec) == -1);
+    assert(vector_remove(vec, 0));
+    assert(*(int *)vector_back(vec) == 99);
+
+    vector_free(vec);
+    printf("  OK\n");
+}
+
+static void test_small_in_arena(void)
+{
+    printf("[TEST] small vector inside an arena...\n");
+
+    Arena *arena = arena_new(0);
+    Arena *prev = arena_use(arena);
+
+    // Arena 中相邻分配的普通 Vector 不能被误认为内联存储
+    Vector *plain = vector_new(sizeof(int));
+    Vector *small = vector_new_small(sizeof(int), 2);
+    for (int i = 0; i < 10; ++i)
+    {
+        assert(vector_push_back(plain, &i));
+        assert(vector_push_back(small, &i));
+    }
+    for (int i = 0; i < 10; ++i)
+        assert(*(int *)vector_get(plain, i) == i && *(int *)vector_get(small, i) == i);
+
+    vector_free(plain);
+    vector_free(small);
+
+    arena_use(prev);
+    arena_free(arena);
+    printf("  OK\n");
+}
+
+static void test_typed_accessors(void)
+{
+    printf("[TEST] typed vector accessors...\n");
+
+    Vector *vec = pair_vec_new();
+    assert(vec->ele_size == sizeof(Pair));
+    for (int i = 0; i < 50; ++i)
+        assert(pair_vec_push(vec, (Pair){i, i * 0.5}));
+
+    // 与通用接口看到的是同一份数据
+    for (int i = 0; i < 50; ++i)
+    {
+        assert(pair_vec_at(vec, i).a == i);
+        assert(pair_vec_ptr(vec, i) == vector_get(vec, i));
+    }
+    pair_vec_data(vec)[3].a = 100;
+    assert(((Pair *)vector_get(vec, 3))->a == 100);
+
+    assert(pair_vec_back(vec).a == 49);
+    assert(pair_vec_pop(vec).a == 49);
+    assert(vec->size == 49 && pair_vec_back(vec).b == 24.0);
+
+    vector_free(vec);
+    printf("  OK\n");
+}
+
+static void test_bulk_and_shrink(void)
+{
+    printf("[TEST] vector append / extend / shrink...\n");
+
+    int src[10];
+    for (int i = 0; i < 10; ++i)
+        src[i] = i;
+
+    Vector *vec = vector_new(sizeof(int));
+    assert(vector_append_n(vec, src, 10));
+    assert(vector_append_n(vec, src, 0));
+    assert(vec->size == 10);
+
+    // 追加自身
+    assert(vector_extend_from(vec, vec));
+    assert(vec->size == 20);
+    for (int i = 0; i < 20; ++i)
+        assert(*(int *)vector_get(vec, i) == i % 10);
+
+    Vector *other = vector_new(sizeof(char));
+    assert(!vector_extend_from(vec, other));
+    vector_free(other);
+
+    assert(vector_reserve_exact(vec, 100) && vec->capacity == 100);
+    assert(vector_shrink_to_fit(vec) && vec->capacity == 20);
+    assert(*(int *)vector_back(vec) == 9);
+
+    // reserve 至少翻倍
+    assert(vector_reserve(vec, 21) && vec->capacity == 40);
+    vector_free(vec);
+
+    // 清空后的普通 Vector 收缩时释放数据区，之后仍可正常使用
+    Vector *plain = vector_new(sizeof(int));
+    assert(vector_push_back(plain, &src[1]));
+    assert(vector_pop_back(plain));
+    assert(vector_shrink_to_fit(plain));
+    assert(plain->data == NULL && plain->capacity == 0);
+    assert(vector_push_back(plain, &src[2]));
+    assert(*(int *)vector_back(plain) == 2);
+    vector_free(plain);
+
+    // 溢出到堆上后清空的小 Vector 收缩时回到内联存储
+    Vector *emptied = vector_new_small(sizeof(int), 4);
+    assert(vector_append_n(emptied, src, 10));
+    assert(emptied->data != (void *)(emptied + 1));
+    while (emptied->size)
+        vector_pop_back(emptied);
+    assert(vector_shrink_to_fit(emptied));
+    assert(emptied->data == (void *)(emptied + 1) && emptied->capacity == 4);
+    assert(vector_push_back(emptied, &src[2]));
+    assert(emptied->data == (void *)(emptied + 1));
+    vector_free(emptied);
+
+    // 缩小到内联存储放得下时搬回内联存储
+    Vector *small = vector_new_small(sizeof(int), 4);
+    assert(vector_append_n(small, src, 10));
+    assert(small->data != (void *)(small + 1));
+    while (small->size > 3)
+        vector_pop_back(small);
+    assert(vector_shrink_to_fit(small));
+    assert(small->data == (void *)(small + 1) && small->capacity == 4);
+    assert(*(int *)vector_back(small) == 2);
+    vector_free(small);
+
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_small_inline_then_spill();
+    test_small_in_arena();
+    test_typed_accessors();
+    test_bulk_and_shrink();
+    return 0;
+}
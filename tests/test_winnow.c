@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "tokenizer.h"
+#include "vector.h"
+#include "tokenizer_impl/token_stream.h"
+#include "fingerprint_impl/normalize.h"
+#include "fingerprint_impl/ngram.h"
+#include "fingerprint_impl/winnow.h"
+
+#include "test_util.h"
+
+// 直接按定义计算：每个窗口取最右边的最小值，与上一个窗口选中的不同才记录
+static void winnow_naive(const NGram *grams, size_t count, size_t w, Vector *out)
+{
+    if (w > count)
+        w = count;
+    size_t last = SIZE_MAX;
+    for (size_t i = 0; i + w <= count; ++i)
+    {
+        size_t min = i;
+        for (size_t j = i; j < i + w; ++j)
+            if (grams[j].hash <= grams[min].hash)
+                min = j;
+        if (min != last)
+            ngram_vec_push(out, grams[min]);
+        last = min;
+    }
+}
+
+static void test_matches_naive(void)
+{
+    printf("[TEST] winnow matches naive selection...\n");
+
+    enum { COUNT = 3000 };
+    static NGram grams[COUNT];
+    srand(17);
+    for (size_t i = 0; i < COUNT; ++i)
+        grams[i] = (NGram){(uint64_t)(rand() % 50), 3, (uint32_t)i}; // 大量重复的哈希
+
+    size_t windows[] = {1, 2, 4, 17, 100, COUNT, COUNT + 10};
+    for (size_t k = 0; k < sizeof(windows) / sizeof(*windows); ++k)
+    {
+        Vector *got = ngram_vec_new(), *expect = ngram_vec_new();
+        assert(winnow(grams, COUNT, windows[k], got));
+        winnow_naive(grams, COUNT, windows[k], expect);
+
+        assert(got->size == expect->size);
+        for (size_t i = 0; i < got->size; ++i)
+        {
+            NGram a = ngram_vec_at(got, i), b = ngram_vec_at(expect, i);
+            assert(a.hash == b.hash && a.pos == b.pos && a.file == 3);
+        }
+        vector_free(got);
+        vector_free(expect);
+    }
+
+    Vector *out = ngram_vec_new();
+    assert(!winnow(grams, COUNT, 0, out));
+    assert(winnow(grams, 0, 4, out) && out->size == 0);
+    vector_free(out);
+    printf("  OK\n");
+}
+
+static Vector *fingerprints(const char *src, uint32_t file, size_t n, size_t w)
+{
+    NormStream *ns = normalize_src(src);
+    Vector *grams = ngram_vec_new(), *fps = ngram_vec_new();
+    assert(ngram_hashes(ns, n, file, grams));
+    assert(winnow(ngram_vec_data(grams), grams->size, w, fps));
+
+    vector_free(grams);
+    norm_stream_free(ns);
+    return fps;
+}
+
+static size_t symbol_count(const char *src)
+{
+    NormStream *ns = normalize_src(src);
+    size_t n = ns->size;
+    norm_stream_free(ns);
+    return n;
+}
+
+static void test_detects_copied_block(void)
+{
+    printf("[TEST] winnow detects a copied block...\n");
+
+    // 一段被改名后嵌进另一个大文件的代码
+    const char *a = "static int clamp(int v, int lo, int hi)\n"
+                    "{\n"
+                    "    if (v < lo) return lo;\n"
+                    "    if (v > hi) return hi;\n"
+                    "    return v;\n"
+                    "}\n";
+    const char *pre = "struct point { double x, y; };\n"
+                      "void scale(struct point *p, double k) { p->x *= k; p->y *= k; }\n";
+    const char *block = "static long bound(long x, long min, long max)\n"
+                        "{\n"
+                        "    if (x < min) return min;\n"
+                        "    if (x > max) return max;\n"
+                        "    return x;\n"
+                        "}\n";
+    const char *post = "double dot(struct point p, struct point q) { return p.x * q.x + p.y * q.y; }\n";
+
+    char b[1024];
+    snprintf(b, sizeof(b), "%s%s%s", pre, block, post);
+    size_t begin = symbol_count(pre), end = begin + symbol_count(block);
+
+    size_t n = 5, w = 4;
+    Vector *fa = fingerprints(a, 0, n, w);
+    Vector *fb = fingerprints(b, 1, n, w);
+    assert(fa->size && fb->size);
+
+    // 复制的片段长度超过 w + n - 1，必定有指纹落在其中且与 a 共享
+    assert(end - begin >= w + n - 1);
+    int inside = 0;
+    for (size_t i = 0; i < fa->size; ++i)
+        for (size_t j = 0; j < fb->size; ++j)
+        {
+            NGram g = ngram_vec_at(fb, j);
+            if (ngram_vec_at(fa, i).hash == g.hash && g.pos >= begin && g.pos + n <= end)
+                inside++;
+        }
+    assert(inside);
+
+    // 指纹个数远少于 N-Gram 个数
+    assert(fb->size < symbol_count(b) - n + 1);
+
+    vector_free(fa);
+    vector_free(fb);
+    printf("  OK\n");
+}
+
+int main(void)
+{
+    test_matches_naive();
+    test_detects_copied_block();
+    return 0;
+}